@@ -0,0 +1,120 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "async_compute_speedup.h"
+#include "log.h"
+
+#include <algorithm>
+
+namespace
+{
+
+std::string option_value(BenchmarkResult const& result, std::string const& name)
+{
+    for (auto const& opt : result.options)
+    {
+        if (opt.first == name)
+            return opt.second;
+    }
+
+    return "";
+}
+
+std::vector<std::pair<std::string, std::string>> options_without_queue(
+    BenchmarkResult const& result)
+{
+    auto options = result.options;
+
+    options.erase(
+        std::remove_if(options.begin(), options.end(),
+                       [](auto const& opt) { return opt.first == "queue"; }),
+        options.end());
+
+    return options;
+}
+
+bool dedicated_queue(BenchmarkResult const& result)
+{
+    for (auto const& metric : result.metrics)
+    {
+        if (metric.first == "async_compute_queue")
+            return metric.second != 0.0;
+    }
+
+    return false;
+}
+
+}
+
+std::vector<AsyncComputeSpeedupEntry> AsyncComputeSpeedup::compute(
+    std::vector<BenchmarkResult> const& results)
+{
+    std::vector<AsyncComputeSpeedupEntry> entries;
+
+    for (auto const& result : results)
+    {
+        if (option_value(result, "queue") != "async")
+            continue;
+
+        AsyncComputeSpeedupEntry entry{
+            result.description, result.fps, dedicated_queue(result), false, 0, 0.0};
+        auto const options = options_without_queue(result);
+
+        for (auto const& serial : results)
+        {
+            if (serial.scene != result.scene ||
+                option_value(serial, "queue") != "serial" ||
+                options_without_queue(serial) != options)
+            {
+                continue;
+            }
+
+            entry.has_baseline = true;
+            entry.serial_fps = serial.fps;
+            if (serial.fps > 0)
+                entry.speedup = static_cast<double>(result.fps) / serial.fps;
+            break;
+        }
+
+        entries.push_back(entry);
+    }
+
+    return entries;
+}
+
+void AsyncComputeSpeedup::log(std::vector<AsyncComputeSpeedupEntry> const& entries)
+{
+    Log::info("    Async compute speedup (over queue=serial)\n");
+
+    for (auto const& e : entries)
+    {
+        char const* const queue = e.dedicated_queue ? "" : " (no dedicated compute queue)";
+
+        if (!e.has_baseline)
+        {
+            Log::info("%s: FPS: %u Serial: <none>%s\n",
+                      e.description.c_str(), e.fps, queue);
+            continue;
+        }
+
+        Log::info("%s: FPS: %u Serial: %u Speedup: %.2fx%s\n",
+                  e.description.c_str(), e.fps, e.serial_fps, e.speedup, queue);
+    }
+}
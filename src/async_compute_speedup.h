@@ -0,0 +1,51 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "results.h"
+
+#include <string>
+#include <vector>
+
+struct AsyncComputeSpeedupEntry
+{
+    std::string description;
+    unsigned int fps;
+    // Whether the compute work ran on a dedicated compute queue
+    bool dedicated_queue;
+    // Only valid if has_baseline is true
+    bool has_baseline;
+    unsigned int serial_fps;
+    double speedup;
+};
+
+namespace AsyncComputeSpeedup
+{
+
+// Compares each result of a scene run with queue=async with the result of
+// the same scene run with queue=serial and otherwise equal option values.
+// As both variants do the same work per frame, the FPS ratio is the
+// combined throughput gained by overlapping compute with rendering.
+std::vector<AsyncComputeSpeedupEntry> compute(std::vector<BenchmarkResult> const& results);
+
+void log(std::vector<AsyncComputeSpeedupEntry> const& entries);
+
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "baseline_comparison.h"
+#include "log.h"
+
+#include <algorithm>
+
+std::vector<BenchmarkComparison> BaselineComparison::compare(
+    std::vector<BenchmarkResult> const& baseline,
+    std::vector<BenchmarkResult> const& results,
+    double threshold)
+{
+    std::vector<BenchmarkComparison> comparisons;
+    // Each baseline result is matched at most once, so that repeated
+    // benchmarks are paired in order
+    std::vector<bool> used(baseline.size(), false);
+
+    for (auto const& result : results)
+    {
+        BenchmarkComparison comparison{result, false, 0, 0.0, false};
+
+        for (size_t i = 0; i < baseline.size(); ++i)
+        {
+            if (used[i] || !Results::same_benchmark(baseline[i], result))
+                continue;
+
+            used[i] = true;
+            comparison.has_baseline = true;
+            comparison.baseline_fps = baseline[i].fps;
+            if (baseline[i].fps > 0)
+            {
+                comparison.change =
+                    100.0 * (static_cast<double>(result.fps) - baseline[i].fps) /
+                    baseline[i].fps;
+            }
+            comparison.regressed = comparison.change < -threshold;
+            break;
+        }
+
+        comparisons.push_back(comparison);
+    }
+
+    return comparisons;
+}
+
+bool BaselineComparison::has_regressions(
+    std::vector<BenchmarkComparison> const& comparisons)
+{
+    return std::any_of(comparisons.begin(), comparisons.end(),
+                       [](auto const& c) { return c.regressed; });
+}
+
+bool BaselineComparison::has_unmatched(
+    std::vector<BenchmarkComparison> const& comparisons)
+{
+    return std::any_of(comparisons.begin(), comparisons.end(),
+                       [](auto const& c) { return !c.has_baseline; });
+}
+
+void BaselineComparison::log(
+    std::vector<BenchmarkComparison> const& comparisons, double threshold)
+{
+    unsigned int num_regressed = 0;
+    unsigned int num_unmatched = 0;
+
+    Log::info("    Baseline comparison (regression threshold: %.1f%%)\n", threshold);
+
+    for (auto const& c : comparisons)
+    {
+        if (!c.has_baseline)
+        {
+            Log::info("%s: FPS: %u Baseline: <none>\n",
+                      c.result.description.c_str(), c.result.fps);
+            ++num_unmatched;
+            continue;
+        }
+
+        Log::info("%s: FPS: %u Baseline: %u Change: %+.2f%%%s\n",
+                  c.result.description.c_str(), c.result.fps, c.baseline_fps,
+                  c.change, c.regressed ? " REGRESSION" : "");
+
+        if (c.regressed)
+            ++num_regressed;
+    }
+
+    Log::info("    Regressions: %u\n", num_regressed);
+    Log::info("    Unmatched: %u\n", num_unmatched);
+}
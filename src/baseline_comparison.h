@@ -0,0 +1,55 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "results.h"
+
+#include <vector>
+
+struct BenchmarkComparison
+{
+    BenchmarkResult result;
+    bool has_baseline;
+    unsigned int baseline_fps;
+    // Relative FPS change from the baseline, in percent
+    double change;
+    bool regressed;
+};
+
+namespace BaselineComparison
+{
+
+// Matches each result with a baseline result of the same benchmark (see
+// Results::same_benchmark). A benchmark is considered regressed if its FPS
+// dropped by more than threshold percent.
+std::vector<BenchmarkComparison> compare(
+    std::vector<BenchmarkResult> const& baseline,
+    std::vector<BenchmarkResult> const& results,
+    double threshold);
+
+bool has_regressions(std::vector<BenchmarkComparison> const& comparisons);
+
+// Whether any result has no matching baseline result, in which case the
+// comparison is incomplete
+bool has_unmatched(std::vector<BenchmarkComparison> const& comparisons);
+
+void log(std::vector<BenchmarkComparison> const& comparisons, double threshold);
+
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "cpu_counters.h"
+#include "log.h"
+
+#include <cstring>
+#include <cerrno>
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace
+{
+
+int open_perf_counter(uint64_t config)
+{
+    struct perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.disabled = 1;
+    attr.inherit = 1;
+    // Excluding the kernel allows use with the default perf_event_paranoid
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    return syscall(__NR_perf_event_open, &attr, 0, -1, -1, PERF_FLAG_FD_CLOEXEC);
+}
+
+uint64_t read_perf_counter(int fd)
+{
+    uint64_t value = 0;
+    if (read(fd, &value, sizeof(value)) != sizeof(value))
+        value = 0;
+    return value;
+}
+
+double timeval_ms(struct timeval const& tv)
+{
+    return tv.tv_sec * 1000.0 + tv.tv_usec / 1000.0;
+}
+
+}
+
+CPUCounters::CPUCounters()
+    : start_rusage{}
+{
+    perf_fds.fill(-1);
+
+    std::array<uint64_t, num_perf_counters> const configs{
+        PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CPU_CYCLES,
+        PERF_COUNT_HW_CACHE_MISSES};
+
+    for (size_t i = 0; i < num_perf_counters; ++i)
+    {
+        perf_fds[i] = open_perf_counter(configs[i]);
+        if (perf_fds[i] < 0)
+        {
+            Log::debug("CPUCounters: Hardware counters are not available: %s\n",
+                       std::strerror(errno));
+            for (auto& fd : perf_fds)
+            {
+                if (fd >= 0)
+                    close(fd);
+                fd = -1;
+            }
+            break;
+        }
+    }
+}
+
+CPUCounters::~CPUCounters()
+{
+    for (auto const fd : perf_fds)
+    {
+        if (fd >= 0)
+            close(fd);
+    }
+}
+
+bool CPUCounters::has_perf_counters() const
+{
+    return perf_fds[0] >= 0;
+}
+
+void CPUCounters::start()
+{
+    if (has_perf_counters())
+    {
+        for (auto const fd : perf_fds)
+        {
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+
+    getrusage(RUSAGE_SELF, &start_rusage);
+}
+
+CPUUsage CPUCounters::stop()
+{
+    struct rusage end_rusage;
+    getrusage(RUSAGE_SELF, &end_rusage);
+
+    CPUUsage usage{};
+
+    usage.user_ms = timeval_ms(end_rusage.ru_utime) - timeval_ms(start_rusage.ru_utime);
+    usage.sys_ms = timeval_ms(end_rusage.ru_stime) - timeval_ms(start_rusage.ru_stime);
+    usage.voluntary_context_switches = end_rusage.ru_nvcsw - start_rusage.ru_nvcsw;
+    usage.involuntary_context_switches = end_rusage.ru_nivcsw - start_rusage.ru_nivcsw;
+
+    if (has_perf_counters())
+    {
+        for (auto const fd : perf_fds)
+            ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+
+        usage.has_perf_counters = true;
+        usage.instructions = read_perf_counter(perf_fds[0]);
+        usage.cycles = read_perf_counter(perf_fds[1]);
+        usage.cache_misses = read_perf_counter(perf_fds[2]);
+    }
+
+    return usage;
+}
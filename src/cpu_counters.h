@@ -0,0 +1,66 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <sys/resource.h>
+
+struct CPUUsage
+{
+    double user_ms;
+    double sys_ms;
+    uint64_t voluntary_context_switches;
+    uint64_t involuntary_context_switches;
+
+    // Hardware counters, only valid if has_perf_counters is true
+    bool has_perf_counters;
+    uint64_t instructions;
+    uint64_t cycles;
+    uint64_t cache_misses;
+};
+
+// Measures the CPU cost of the process between start() and stop(). CPU
+// times and context switches come from getrusage() and cover all threads.
+// Hardware counters use perf_event_open(), count user space only, and cover
+// the creating thread and threads created after it. They are omitted if the
+// kernel doesn't permit them (see /proc/sys/kernel/perf_event_paranoid).
+class CPUCounters
+{
+public:
+    CPUCounters();
+    ~CPUCounters();
+
+    CPUCounters(CPUCounters const&) = delete;
+    CPUCounters& operator=(CPUCounters const&) = delete;
+
+    bool has_perf_counters() const;
+
+    void start();
+    CPUUsage stop();
+
+private:
+    static size_t const num_perf_counters = 3;
+
+    std::array<int, num_perf_counters> perf_fds;
+    struct rusage start_rusage;
+};
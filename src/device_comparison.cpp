@@ -0,0 +1,114 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "device_comparison.h"
+#include "log.h"
+
+#include <cstdio>
+#include <map>
+#include <utility>
+
+namespace
+{
+
+std::string format_score(ScoreMethod method, double score)
+{
+    char buf[64];
+
+    switch (method)
+    {
+        case ScoreMethod::fps:
+            snprintf(buf, sizeof(buf), "%u", static_cast<unsigned int>(score));
+            break;
+        case ScoreMethod::frametime:
+            snprintf(buf, sizeof(buf), "%.3f ms", score);
+            break;
+        default:
+            snprintf(buf, sizeof(buf), "%.2f", score);
+            break;
+    }
+
+    return buf;
+}
+
+}
+
+std::vector<DeviceComparisonRow> DeviceComparison::compute(std::vector<DeviceRun> const& runs)
+{
+    std::vector<DeviceComparisonRow> rows;
+    // Row index of each (description, occurrence) pair
+    std::map<std::pair<std::string, size_t>, size_t> row_index;
+
+    for (size_t r = 0; r < runs.size(); ++r)
+    {
+        std::map<std::string, size_t> occurrences;
+
+        for (auto const& result : runs[r].results)
+        {
+            auto const key = std::make_pair(result.description,
+                                            occurrences[result.description]++);
+            auto iter = row_index.find(key);
+
+            if (iter == row_index.end())
+            {
+                iter = row_index.emplace(key, rows.size()).first;
+                rows.push_back({result.description,
+                                std::vector<std::optional<unsigned int>>(runs.size())});
+            }
+
+            rows[iter->second].fps[r] = result.fps;
+        }
+    }
+
+    return rows;
+}
+
+void DeviceComparison::log(std::vector<DeviceRun> const& runs, ScoreMethod score_method)
+{
+    Log::info("    Device comparison (FPS)\n");
+
+    for (auto const& run : runs)
+    {
+        Log::info("        [%u] %s (%s)\n",
+                  run.device.index, run.device.name.c_str(), run.device.type.c_str());
+    }
+
+    for (auto const& row : DeviceComparison::compute(runs))
+    {
+        std::string line;
+
+        for (size_t r = 0; r < runs.size(); ++r)
+        {
+            line += " [" + std::to_string(runs[r].device.index) + "] " +
+                    (row.fps[r] ? std::to_string(*row.fps[r]) : "<none>");
+        }
+
+        Log::info("%s:%s\n", row.description.c_str(), line.c_str());
+    }
+
+    std::string scores;
+    for (auto const& run : runs)
+    {
+        scores += " [" + std::to_string(run.device.index) + "] " +
+                  format_score(score_method, run.score);
+    }
+
+    Log::info("    vkmark Score (%s):%s\n", to_string(score_method).c_str(), scores.c_str());
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "device_selector.h"
+#include "results.h"
+#include "score.h"
+
+#include <optional>
+#include <string>
+#include <vector>
+
+// The results of running the benchmarks on one physical device
+struct DeviceRun
+{
+    DeviceDescription device;
+    std::vector<BenchmarkResult> results;
+    double score;
+};
+
+struct DeviceComparisonRow
+{
+    std::string description;
+    // The FPS on each device, in the order of the runs, empty if the
+    // benchmark didn't run on the device
+    std::vector<std::optional<unsigned int>> fps;
+};
+
+namespace DeviceComparison
+{
+
+// Lays out the results of the runs side by side, matching benchmarks with
+// the same description (the n-th occurrence of a description in one run
+// matches the n-th occurrence in the others). Rows are in the order the
+// benchmarks first appear.
+std::vector<DeviceComparisonRow> compute(std::vector<DeviceRun> const& runs);
+
+void log(std::vector<DeviceRun> const& runs, ScoreMethod score_method);
+
+}
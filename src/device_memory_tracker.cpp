@@ -0,0 +1,104 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "device_memory_tracker.h"
+
+#include <algorithm>
+
+DeviceMemoryTracker::DeviceMemoryTracker(
+    std::vector<uint32_t> const& heap_of_type, uint32_t num_heaps)
+    : heap_of_type{heap_of_type},
+      bytes_per_type(heap_of_type.size(), 0),
+      bytes_per_heap(num_heaps, 0),
+      total_bytes{0},
+      peak{0}
+{
+}
+
+void DeviceMemoryTracker::allocated(uint64_t id, uint32_t memory_type, uint64_t size)
+{
+    std::lock_guard<std::mutex> lock{mutex};
+
+    if (memory_type >= heap_of_type.size() ||
+        !allocations.emplace(id, Allocation{memory_type, size}).second)
+    {
+        return;
+    }
+
+    bytes_per_type[memory_type] += size;
+    bytes_per_heap[heap_of_type[memory_type]] += size;
+    total_bytes += size;
+    peak = std::max(peak, total_bytes);
+}
+
+void DeviceMemoryTracker::freed(uint64_t id)
+{
+    std::lock_guard<std::mutex> lock{mutex};
+
+    auto const iter = allocations.find(id);
+    if (iter == allocations.end())
+        return;
+
+    auto const& alloc = iter->second;
+    bytes_per_type[alloc.memory_type] -= alloc.size;
+    bytes_per_heap[heap_of_type[alloc.memory_type]] -= alloc.size;
+    total_bytes -= alloc.size;
+
+    allocations.erase(iter);
+}
+
+uint64_t DeviceMemoryTracker::current_bytes() const
+{
+    std::lock_guard<std::mutex> lock{mutex};
+    return total_bytes;
+}
+
+uint64_t DeviceMemoryTracker::type_bytes(uint32_t memory_type) const
+{
+    std::lock_guard<std::mutex> lock{mutex};
+    return memory_type < bytes_per_type.size() ? bytes_per_type[memory_type] : 0;
+}
+
+uint64_t DeviceMemoryTracker::heap_bytes(uint32_t heap) const
+{
+    std::lock_guard<std::mutex> lock{mutex};
+    return heap < bytes_per_heap.size() ? bytes_per_heap[heap] : 0;
+}
+
+uint32_t DeviceMemoryTracker::num_types() const
+{
+    return bytes_per_type.size();
+}
+
+uint32_t DeviceMemoryTracker::num_heaps() const
+{
+    return bytes_per_heap.size();
+}
+
+uint64_t DeviceMemoryTracker::peak_bytes() const
+{
+    std::lock_guard<std::mutex> lock{mutex};
+    return peak;
+}
+
+void DeviceMemoryTracker::reset_peak()
+{
+    std::lock_guard<std::mutex> lock{mutex};
+    peak = total_bytes;
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+// Keeps account of the device memory allocated through vkutil, per memory
+// type and heap. Allocations are identified by their VkDeviceMemory handle
+// value. All methods are thread safe.
+class DeviceMemoryTracker
+{
+public:
+    // heap_of_type[i] is the heap index of memory type i
+    DeviceMemoryTracker(std::vector<uint32_t> const& heap_of_type, uint32_t num_heaps);
+
+    void allocated(uint64_t id, uint32_t memory_type, uint64_t size);
+    void freed(uint64_t id);
+
+    uint64_t current_bytes() const;
+    uint64_t type_bytes(uint32_t memory_type) const;
+    uint64_t heap_bytes(uint32_t heap) const;
+    uint32_t num_types() const;
+    uint32_t num_heaps() const;
+
+    // Highest total since construction or the last reset_peak()
+    uint64_t peak_bytes() const;
+    void reset_peak();
+
+private:
+    struct Allocation
+    {
+        uint32_t memory_type;
+        uint64_t size;
+    };
+
+    mutable std::mutex mutex;
+    std::vector<uint32_t> const heap_of_type;
+    std::unordered_map<uint64_t, Allocation> allocations;
+    std::vector<uint64_t> bytes_per_type;
+    std::vector<uint64_t> bytes_per_heap;
+    uint64_t total_bytes;
+    uint64_t peak;
+};
@@ -0,0 +1,110 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "device_selector.h"
+
+#include <algorithm>
+#include <cctype>
+#include <iterator>
+
+namespace
+{
+
+std::string to_lower(std::string str)
+{
+    std::transform(str.begin(), str.end(), str.begin(),
+                   [](unsigned char c) { return std::tolower(c); });
+    return str;
+}
+
+bool is_uuid(std::string const& str)
+{
+    return str.size() == 2 * VK_UUID_SIZE &&
+           std::all_of(str.begin(), str.end(),
+                       [](char c) { return std::isdigit(c) || (c >= 'a' && c <= 'f'); });
+}
+
+bool is_index(std::string const& str)
+{
+    return !str.empty() && str.size() <= 9 &&
+           std::all_of(str.begin(), str.end(), [](unsigned char c) { return std::isdigit(c); });
+}
+
+bool is_type(std::string const& str)
+{
+    return str == "discrete" || str == "integrated" || str == "virtual" || str == "cpu";
+}
+
+}
+
+DeviceSelector::DeviceSelector(std::string const& selector)
+    : value{to_lower(selector)}
+{
+    if (value.empty())
+    {
+        kind = Kind::all;
+    }
+    else if (is_uuid(value))
+    {
+        kind = Kind::uuid;
+        uuid = DeviceUUID{value};
+    }
+    else if (is_index(value))
+    {
+        kind = Kind::index;
+        index = std::stoul(value);
+    }
+    else if (is_type(value))
+    {
+        kind = Kind::type;
+    }
+    else
+    {
+        kind = Kind::name;
+    }
+}
+
+bool DeviceSelector::matches(DeviceDescription const& device) const
+{
+    switch (kind)
+    {
+        case Kind::uuid:
+            return device.uuid == uuid;
+        case Kind::index:
+            return device.index == index;
+        case Kind::type:
+            return device.type == value;
+        case Kind::name:
+            return to_lower(device.name).find(value) != std::string::npos;
+        default:
+            return true;
+    }
+}
+
+std::vector<DeviceDescription> DeviceSelector::select(
+    std::vector<DeviceDescription> const& devices) const
+{
+    std::vector<DeviceDescription> selected;
+
+    std::copy_if(devices.begin(), devices.end(), std::back_inserter(selected),
+                 [this](auto const& device) { return matches(device); });
+
+    return selected;
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "device_uuid.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct DeviceDescription
+{
+    // Position in the enumeration order, as shown by --list-devices
+    uint32_t index;
+    // One of discrete, integrated, virtual, cpu or other
+    std::string type;
+    std::string name;
+    DeviceUUID uuid;
+};
+
+// Selects physical devices by UUID, index, type or name. The selector is
+// interpreted as a UUID if it is a 32 digit hex string, as an index if it
+// is a number, as a type if it is one of the device types, and otherwise
+// as a case-insensitive substring of the device name. An empty selector
+// matches all devices.
+class DeviceSelector
+{
+public:
+    DeviceSelector() = default;
+    explicit DeviceSelector(std::string const& selector);
+
+    bool matches(DeviceDescription const& device) const;
+    // The matching devices, in the given order
+    std::vector<DeviceDescription> select(std::vector<DeviceDescription> const& devices) const;
+
+private:
+    enum class Kind { all, uuid, index, type, name };
+
+    Kind kind = Kind::all;
+    std::string value;
+    DeviceUUID uuid;
+    uint32_t index = 0;
+};
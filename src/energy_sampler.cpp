@@ -0,0 +1,228 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "energy_sampler.h"
+#include "log.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+
+bool read_value(std::string const& path, uint64_t& value)
+{
+    std::ifstream ifs{path};
+    return static_cast<bool>(ifs >> value);
+}
+
+bool starts_with(std::string const& str, std::string const& start)
+{
+    return str.compare(0, start.size(), start) == 0;
+}
+
+bool ends_with(std::string const& str, std::string const& end)
+{
+    return str.size() > end.size() &&
+           std::equal(end.rbegin(), end.rend(), str.rbegin());
+}
+
+std::vector<fs::path> sorted_dir_entries(fs::path const& dir)
+{
+    std::vector<fs::path> entries;
+    std::error_code ec;
+
+    for (auto const& entry : fs::directory_iterator{dir, ec})
+        entries.push_back(entry.path());
+
+    std::sort(entries.begin(), entries.end());
+
+    return entries;
+}
+
+}
+
+EnergySampler::EnergySampler(std::string const& sysfs_root,
+                             std::chrono::milliseconds interval)
+    : interval{interval},
+      joules{0.0},
+      should_stop{false}
+{
+    find_sources(sysfs_root);
+
+    for (auto const& source : sources)
+        Log::debug("EnergySampler: Using %s\n", source.path.c_str());
+}
+
+EnergySampler::~EnergySampler()
+{
+    if (thread.joinable())
+        stop();
+}
+
+bool EnergySampler::has_sources() const
+{
+    return !sources.empty();
+}
+
+std::vector<std::string> EnergySampler::source_paths() const
+{
+    std::vector<std::string> paths;
+
+    for (auto const& source : sources)
+        paths.push_back(source.path);
+
+    return paths;
+}
+
+void EnergySampler::find_sources(std::string const& sysfs_root)
+{
+    // Only use top-level RAPL zones (e.g. intel-rapl:0), since subzones
+    // (e.g. intel-rapl:0:0) are included in their parent's energy
+    for (auto const& zone : sorted_dir_entries(fs::path{sysfs_root} / "class/powercap"))
+    {
+        auto const name = zone.filename().string();
+        if (!starts_with(name, "intel-rapl:") ||
+            std::count(name.begin(), name.end(), ':') != 1)
+        {
+            continue;
+        }
+
+        Source source{Source::Type::energy, (zone / "energy_uj").string(), 0, 0};
+        if (!read_value(source.path, source.last_value))
+            continue;
+        read_value((zone / "max_energy_range_uj").string(), source.max_value);
+
+        sources.push_back(source);
+    }
+
+    for (auto const& hwmon : sorted_dir_entries(fs::path{sysfs_root} / "class/hwmon"))
+    {
+        std::vector<Source> energy_sources;
+        std::vector<Source> power_sources;
+
+        for (auto const& file : sorted_dir_entries(hwmon))
+        {
+            auto const name = file.filename().string();
+            if (!ends_with(name, "_input"))
+                continue;
+
+            Source source{Source::Type::energy, file.string(), 0, 0};
+            if (starts_with(name, "power"))
+                source.type = Source::Type::power;
+            else if (!starts_with(name, "energy"))
+                continue;
+
+            if (!read_value(source.path, source.last_value))
+                continue;
+
+            if (source.type == Source::Type::energy)
+                energy_sources.push_back(source);
+            else
+                power_sources.push_back(source);
+        }
+
+        // Prefer energy counters over integrating power readings of the
+        // same device
+        auto const& device_sources =
+            energy_sources.empty() ? power_sources : energy_sources;
+        sources.insert(sources.end(), device_sources.begin(), device_sources.end());
+    }
+}
+
+void EnergySampler::start()
+{
+    if (thread.joinable())
+        stop();
+
+    for (auto& source : sources)
+        read_value(source.path, source.last_value);
+
+    joules = 0.0;
+    start_time = std::chrono::steady_clock::now();
+    last_sample_time = start_time;
+    should_stop = false;
+
+    thread = std::thread{[this] { run(); }};
+}
+
+EnergyMeasurement EnergySampler::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        should_stop = true;
+    }
+    stop_cv.notify_all();
+
+    if (thread.joinable())
+        thread.join();
+
+    sample();
+
+    std::chrono::duration<double> const elapsed = last_sample_time - start_time;
+
+    return {joules, elapsed.count()};
+}
+
+void EnergySampler::run()
+{
+    std::unique_lock<std::mutex> lock{mutex};
+
+    while (!stop_cv.wait_for(lock, interval, [this] { return should_stop; }))
+        sample();
+}
+
+void EnergySampler::sample()
+{
+    auto const now = std::chrono::steady_clock::now();
+    std::chrono::duration<double> const dt = now - last_sample_time;
+
+    for (auto& source : sources)
+    {
+        uint64_t value;
+        if (!read_value(source.path, value))
+            continue;
+
+        if (source.type == Source::Type::energy)
+        {
+            // Energy counters are in uJ and may wrap around
+            uint64_t delta;
+            if (value >= source.last_value)
+                delta = value - source.last_value;
+            else if (source.max_value > source.last_value)
+                delta = source.max_value - source.last_value + value;
+            else
+                delta = value;
+
+            joules += delta / 1000000.0;
+        }
+        else
+        {
+            // Power readings are in uW, use the trapezoidal rule
+            joules += (source.last_value + value) / 2.0 / 1000000.0 * dt.count();
+        }
+
+        source.last_value = value;
+    }
+
+    last_sample_time = now;
+}
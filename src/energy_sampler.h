@@ -0,0 +1,80 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct EnergyMeasurement
+{
+    double joules;
+    double seconds;
+};
+
+// Measures host energy usage by periodically sampling sysfs energy and power
+// counters on a background thread. Supported sources are the top-level
+// Intel RAPL powercap zones (energy_uj) and hwmon energy*_input and
+// power*_input files. The energy of all sources is summed.
+class EnergySampler
+{
+public:
+    EnergySampler(std::string const& sysfs_root,
+                  std::chrono::milliseconds interval);
+    ~EnergySampler();
+
+    bool has_sources() const;
+    std::vector<std::string> source_paths() const;
+
+    void start();
+    // Stops sampling and returns the energy used since the last start()
+    EnergyMeasurement stop();
+
+private:
+    struct Source
+    {
+        enum class Type { energy, power };
+
+        Type type;
+        std::string path;
+        // Value at which an energy counter wraps around, 0 if unknown
+        uint64_t max_value;
+        uint64_t last_value;
+    };
+
+    void find_sources(std::string const& sysfs_root);
+    void sample();
+    void run();
+
+    std::chrono::milliseconds const interval;
+    std::vector<Source> sources;
+    std::chrono::steady_clock::time_point start_time;
+    std::chrono::steady_clock::time_point last_sample_time;
+    double joules;
+
+    std::thread thread;
+    std::mutex mutex;
+    std::condition_variable stop_cv;
+    bool should_stop;
+};
@@ -0,0 +1,90 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "frame_capture.h"
+#include "frame_writer.h"
+#include "trace.h"
+#include "util.h"
+
+#include <algorithm>
+
+FrameCapture::FrameCapture(VulkanState& vulkan, vk::Extent2D extent, vk::Format format,
+                           uint32_t num_buffers, FrameWriter& writer)
+    : writer{writer},
+      next{0},
+      frames_captured_{0},
+      wait_time_{0}
+{
+    for (uint32_t i = 0; i < std::max(num_buffers, 1u); ++i)
+        slots.push_back({std::make_unique<ImageReadback>(vulkan, extent, format), "", 0, false});
+}
+
+VulkanImage FrameCapture::capture(VulkanImage const& image, std::string const& stem,
+                                  uint64_t frame)
+{
+    auto& slot = slots[next];
+    next = (next + 1) % slots.size();
+
+    if (slot.pending)
+        collect(slot);
+
+    slot.stem = stem;
+    slot.frame = frame;
+    slot.pending = true;
+    ++frames_captured_;
+
+    return slot.readback->submit(image);
+}
+
+void FrameCapture::finish()
+{
+    // Oldest first, to keep the frames in order
+    for (size_t i = 0; i < slots.size(); ++i)
+    {
+        auto& slot = slots[(next + i) % slots.size()];
+        if (slot.pending)
+            collect(slot);
+    }
+}
+
+uint64_t FrameCapture::frames_captured() const
+{
+    return frames_captured_;
+}
+
+uint64_t FrameCapture::wait_time() const
+{
+    return wait_time_;
+}
+
+void FrameCapture::collect(Slot& slot)
+{
+    if (!slot.readback->is_complete())
+    {
+        auto const wait_start = Util::get_timestamp_us();
+        Trace::traced("wait_capture", [&] { slot.readback->wait(); });
+        wait_time_ += Util::get_timestamp_us() - wait_start;
+    }
+
+    auto const extent = slot.readback->extent();
+    writer.write(slot.stem, slot.frame, extent.width, extent.height,
+                 slot.readback->rgba());
+    slot.pending = false;
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "image_readback.h"
+#include "vulkan_image.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+class VulkanState;
+class FrameWriter;
+
+// Captures frames without stalling the rendering loop. Each captured frame
+// is copied to the next of a ring of readback buffers, and its copy is only
+// checked for completion when the ring wraps around, num_buffers captures
+// later, or at the end of the benchmark. By then the copy has usually
+// completed, so the pixels are handed to the FrameWriter without waiting.
+class FrameCapture
+{
+public:
+    FrameCapture(VulkanState& vulkan, vk::Extent2D extent, vk::Format format,
+                 uint32_t num_buffers, FrameWriter& writer);
+
+    // Submits the copy of a frame, to be written to a file with the given
+    // path stem. Returns the image to present.
+    VulkanImage capture(VulkanImage const& image, std::string const& stem, uint64_t frame);
+
+    // Waits for all submitted copies and hands them to the writer
+    void finish();
+
+    uint64_t frames_captured() const;
+    // Total time in microseconds spent waiting for copies that had not
+    // completed when their buffer was needed again
+    uint64_t wait_time() const;
+
+private:
+    struct Slot
+    {
+        std::unique_ptr<ImageReadback> readback;
+        std::string stem;
+        uint64_t frame;
+        bool pending;
+    };
+
+    void collect(Slot& slot);
+
+    FrameWriter& writer;
+    std::vector<Slot> slots;
+    // The slot of the next capture, which holds the oldest pending copy
+    uint32_t next;
+    uint64_t frames_captured_;
+    uint64_t wait_time_;
+};
@@ -0,0 +1,59 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "frame_progress.h"
+
+void FrameProgress::submitted(uint64_t value, uint64_t time)
+{
+    pending_.emplace_back(value, time);
+}
+
+void FrameProgress::completed(uint64_t value, uint64_t time)
+{
+    while (!pending_.empty() && pending_.front().first <= value)
+    {
+        auto const submit_time = pending_.front().second;
+        latency_stats_.add(time > submit_time ? (time - submit_time) / 1000.0 : 0.0);
+        pending_.pop_front();
+    }
+
+    pending_stats_.add(pending_.size());
+}
+
+uint64_t FrameProgress::pending() const
+{
+    return pending_.size();
+}
+
+RunningStats const& FrameProgress::latency_stats() const
+{
+    return latency_stats_;
+}
+
+RunningStats const& FrameProgress::pending_stats() const
+{
+    return pending_stats_;
+}
+
+void FrameProgress::reset_stats()
+{
+    latency_stats_.reset();
+    pending_stats_.reset();
+}
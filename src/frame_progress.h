@@ -0,0 +1,57 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "running_stats.h"
+
+#include <cstdint>
+#include <deque>
+#include <utility>
+
+// Tracks the progress of the GPU through the submitted frames, identified
+// by increasing values (e.g. the values a timeline semaphore is signaled
+// with), and measures the time from the submission of each frame until
+// its completion is observed.
+class FrameProgress
+{
+public:
+    // Records that the frame with the given value was submitted at time
+    // (in microseconds)
+    void submitted(uint64_t value, uint64_t time);
+    // Records that all frames up to and including value have completed,
+    // as observed at time (in microseconds)
+    void completed(uint64_t value, uint64_t time);
+
+    // Number of submitted frames whose completion has not been observed
+    uint64_t pending() const;
+
+    // Submission to completion latency of each completed frame in ms
+    RunningStats const& latency_stats() const;
+    // Number of frames still pending on the GPU at each completion check
+    RunningStats const& pending_stats() const;
+    // Resets the statistics, but keeps tracking the pending frames
+    void reset_stats();
+
+private:
+    std::deque<std::pair<uint64_t, uint64_t>> pending_;
+    RunningStats latency_stats_;
+    RunningStats pending_stats_;
+};
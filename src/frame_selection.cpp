@@ -0,0 +1,93 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "frame_selection.h"
+#include "util.h"
+
+#include <algorithm>
+#include <cctype>
+#include <stdexcept>
+
+namespace
+{
+
+uint64_t parse_frame(std::string const& str, std::string const& selection)
+{
+    if (str.empty() ||
+        !std::all_of(str.begin(), str.end(), [](unsigned char c) { return std::isdigit(c); }))
+    {
+        throw std::runtime_error{"Invalid frame selection '" + selection + "'"};
+    }
+
+    auto const frame = Util::from_string<uint64_t>(str);
+    if (frame == 0)
+        throw std::runtime_error{"Invalid frame selection '" + selection + "'"};
+
+    return frame;
+}
+
+}
+
+FrameSelection::FrameSelection(std::string const& str)
+{
+    if (str == "all")
+    {
+        all = true;
+        return;
+    }
+
+    for (auto const& item : Util::split(str, ','))
+    {
+        auto const bounds = Util::split(item, '-');
+
+        if (bounds.size() == 1)
+        {
+            auto const frame = parse_frame(bounds[0], str);
+            ranges.emplace_back(frame, frame);
+        }
+        else if (bounds.size() == 2)
+        {
+            auto const first = parse_frame(bounds[0], str);
+            auto const last = parse_frame(bounds[1], str);
+            if (first > last)
+                throw std::runtime_error{"Invalid frame selection '" + str + "'"};
+            ranges.emplace_back(first, last);
+        }
+        else
+        {
+            throw std::runtime_error{"Invalid frame selection '" + str + "'"};
+        }
+    }
+
+    if (ranges.empty())
+        throw std::runtime_error{"Invalid frame selection '" + str + "'"};
+}
+
+bool FrameSelection::empty() const
+{
+    return !all && ranges.empty();
+}
+
+bool FrameSelection::contains(uint64_t frame) const
+{
+    return all ||
+           std::any_of(ranges.begin(), ranges.end(),
+                       [frame](auto const& r) { return frame >= r.first && frame <= r.second; });
+}
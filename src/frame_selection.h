@@ -0,0 +1,43 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+// A set of frame numbers, counted from 1, parsed from "all" or from a comma
+// separated list of frames and inclusive ranges of frames, e.g.
+// "1,10,100-200". A default constructed selection contains no frames.
+class FrameSelection
+{
+public:
+    FrameSelection() = default;
+    explicit FrameSelection(std::string const& str);
+
+    bool empty() const;
+    bool contains(uint64_t frame) const;
+
+private:
+    bool all = false;
+    std::vector<std::pair<uint64_t, uint64_t>> ranges;
+};
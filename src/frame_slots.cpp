@@ -0,0 +1,200 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "frame_slots.h"
+
+#include "vulkan_state.h"
+#include "trace.h"
+#include "util.h"
+
+#include <mutex>
+
+FrameSlots::FrameSlots(VulkanState& vulkan, uint32_t num_slots, bool use_timeline)
+    : vulkan{vulkan},
+      slot_values(num_slots, 0),
+      last_value{0},
+      current{num_slots - 1},
+      wait_time_{0}
+{
+    for (uint32_t i = 0; i < num_slots; ++i)
+    {
+        semaphores.push_back(ManagedResource<vk::Semaphore>{
+            vulkan.device().createSemaphore(vk::SemaphoreCreateInfo()),
+            [vptr=&vulkan] (auto const& s) { vptr->device().destroySemaphore(s); }});
+        if (!use_timeline)
+        {
+            fences.push_back(ManagedResource<vk::Fence>{
+                vulkan.device().createFence(vk::FenceCreateInfo(vk::FenceCreateFlagBits::eSignaled)),
+                [vptr=&vulkan] (auto const& f) { vptr->device().destroyFence(f); }});
+        }
+    }
+
+    if (use_timeline)
+    {
+        VkSemaphoreTypeCreateInfoKHR type_create_info{};
+        type_create_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR;
+        type_create_info.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE_KHR;
+        type_create_info.initialValue = 0;
+
+        timeline = ManagedResource<vk::Semaphore>{
+            vulkan.device().createSemaphore(vk::SemaphoreCreateInfo().setPNext(&type_create_info)),
+            [vptr=&vulkan] (auto const& s) { vptr->device().destroySemaphore(s); }};
+    }
+}
+
+uint32_t FrameSlots::num_slots() const
+{
+    return semaphores.size();
+}
+
+bool FrameSlots::uses_timeline() const
+{
+    return static_cast<bool>(timeline.raw);
+}
+
+uint32_t FrameSlots::next()
+{
+    current = (current + 1) % semaphores.size();
+
+    auto const start = Util::get_timestamp_us();
+
+    if (uses_timeline())
+    {
+        Trace::traced("wait_frame_timeline", [&] {
+            (void)vulkan.wait_timeline_semaphore(timeline, slot_values[current], UINT64_MAX);
+        });
+
+        progress_.completed(vulkan.timeline_semaphore_value(timeline),
+                            Util::get_timestamp_us());
+    }
+    else
+    {
+        Trace::traced("wait_frame_fence", [&] {
+            (void)vulkan.device().waitForFences(fences[current].raw, true, INT64_MAX);
+        });
+        vulkan.device().resetFences(fences[current].raw);
+    }
+
+    wait_time_ += Util::get_timestamp_us() - start;
+
+    return current;
+}
+
+VulkanImage FrameSlots::submit(vk::CommandBuffer const& command_buffer,
+                               VulkanImage const& image,
+                               vk::Semaphore wait_semaphore,
+                               vk::PipelineStageFlags wait_stage)
+{
+    std::vector<vk::Semaphore> wait_semaphores;
+    std::vector<vk::PipelineStageFlags> wait_masks;
+
+    if (image.semaphore)
+    {
+        wait_semaphores.push_back(image.semaphore);
+        wait_masks.push_back(vk::PipelineStageFlagBits::eColorAttachmentOutput);
+    }
+
+    if (wait_semaphore)
+    {
+        wait_semaphores.push_back(wait_semaphore);
+        wait_masks.push_back(wait_stage);
+    }
+
+    auto submit_info = vk::SubmitInfo{}
+        .setCommandBufferCount(1)
+        .setPCommandBuffers(&command_buffer)
+        .setWaitSemaphoreCount(wait_semaphores.size())
+        .setPWaitSemaphores(wait_semaphores.data())
+        .setPWaitDstStageMask(wait_masks.data())
+        .setSignalSemaphoreCount(image.semaphore ? 1 : 0)
+        .setPSignalSemaphores(&semaphores[current].raw);
+
+    if (uses_timeline())
+    {
+        // A single submission signals both the binary semaphore for
+        // presentation (if needed) and the timeline, so neither the slot
+        // nor the window system needs a fence
+        slot_values[current] = ++last_value;
+
+        std::vector<vk::Semaphore> signal_semaphores;
+        if (image.semaphore)
+            signal_semaphores.push_back(semaphores[current]);
+        signal_semaphores.push_back(timeline);
+
+        // Values are ignored for binary semaphores
+        std::vector<uint64_t> const wait_values(wait_semaphores.size(), 0);
+        std::vector<uint64_t> signal_values(signal_semaphores.size(), 0);
+        signal_values.back() = last_value;
+
+        VkTimelineSemaphoreSubmitInfoKHR timeline_submit_info{};
+        timeline_submit_info.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR;
+        timeline_submit_info.waitSemaphoreValueCount = wait_values.size();
+        timeline_submit_info.pWaitSemaphoreValues = wait_values.data();
+        timeline_submit_info.signalSemaphoreValueCount = signal_values.size();
+        timeline_submit_info.pSignalSemaphoreValues = signal_values.data();
+
+        submit_info
+            .setSignalSemaphoreCount(signal_semaphores.size())
+            .setPSignalSemaphores(signal_semaphores.data())
+            .setPNext(&timeline_submit_info);
+
+        {
+            std::lock_guard<std::mutex> const lock{vulkan.queue_mutex()};
+            vulkan.graphics_queue().submit(submit_info, nullptr);
+        }
+        progress_.submitted(last_value, Util::get_timestamp_us());
+
+        return image.copy_with_semaphore(semaphores[current])
+                    .copy_with_timeline(timeline, last_value);
+    }
+
+    std::lock_guard<std::mutex> const lock{vulkan.queue_mutex()};
+
+    if (image.submit_fence)
+    {
+        // The window system needs its own fence, so signal the slot fence
+        // with a submission without batches, which completes after all
+        // previously submitted work
+        vulkan.graphics_queue().submit(submit_info, image.submit_fence);
+        vulkan.graphics_queue().submit(nullptr, fences[current]);
+    }
+    else
+    {
+        vulkan.graphics_queue().submit(submit_info, fences[current]);
+    }
+
+    return image.copy_with_semaphore(semaphores[current]);
+}
+
+uint64_t FrameSlots::wait_time() const
+{
+    return wait_time_;
+}
+
+FrameProgress const& FrameSlots::progress() const
+{
+    return progress_;
+}
+
+void FrameSlots::reset_stats()
+{
+    wait_time_ = 0;
+    progress_.reset_stats();
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "frame_progress.h"
+#include "managed_resource.h"
+#include "vulkan_image.h"
+
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+class VulkanState;
+
+// Synchronization objects for pipelining up to num_slots frames, independently
+// of the number of swapchain images. Each slot has a semaphore signaled
+// when its rendering is done, and a fence that is waited for before the
+// resources of the slot are reused.
+//
+// With timeline semaphores, the fences are replaced by a single timeline
+// semaphore signaled with the number of each submitted frame, which also
+// lets the CPU observe how far the GPU has progressed.
+class FrameSlots
+{
+public:
+    FrameSlots(VulkanState& vulkan, uint32_t num_slots, bool use_timeline);
+
+    uint32_t num_slots() const;
+    bool uses_timeline() const;
+
+    // Waits until the next slot is no longer in use by the GPU and returns
+    // its index
+    uint32_t next();
+
+    // Submits the command buffer of the current slot, waiting for the
+    // image semaphore and, if set, for wait_semaphore at wait_stage (e.g.
+    // for work submitted to another queue). Returns the image with the
+    // semaphore to wait for before presenting.
+    VulkanImage submit(vk::CommandBuffer const& command_buffer,
+                       VulkanImage const& image,
+                       vk::Semaphore wait_semaphore = nullptr,
+                       vk::PipelineStageFlags wait_stage = {});
+
+    // Total time in microseconds spent waiting for slots to become
+    // available since the last reset_stats()
+    uint64_t wait_time() const;
+    // GPU progress through the submitted frames, only tracked with
+    // timeline semaphores
+    FrameProgress const& progress() const;
+    void reset_stats();
+
+private:
+    VulkanState& vulkan;
+    std::vector<ManagedResource<vk::Semaphore>> semaphores;
+    std::vector<ManagedResource<vk::Fence>> fences;
+    ManagedResource<vk::Semaphore> timeline;
+    // Timeline value signaled by the last submission of each slot
+    std::vector<uint64_t> slot_values;
+    uint64_t last_value;
+    FrameProgress progress_;
+    uint32_t current;
+    uint64_t wait_time_;
+};
@@ -0,0 +1,159 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "frame_time_stats.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+
+unsigned int floor_log2(uint64_t value)
+{
+    unsigned int log = 0;
+    while (value >>= 1)
+        ++log;
+    return log;
+}
+
+}
+
+FrameTimeStats::FrameTimeStats()
+{
+    reset();
+}
+
+void FrameTimeStats::reset()
+{
+    buckets.fill(0);
+    count_ = 0;
+    min_ = 0;
+    max_ = 0;
+    sum = 0.0;
+    sum_squares = 0.0;
+}
+
+void FrameTimeStats::record(uint64_t frame_time)
+{
+    auto& bucket = buckets[bucket_index(frame_time)];
+    if (bucket < UINT32_MAX)
+        ++bucket;
+
+    if (count_ == 0 || frame_time < min_)
+        min_ = frame_time;
+    if (count_ == 0 || frame_time > max_)
+        max_ = frame_time;
+
+    ++count_;
+    sum += frame_time;
+    sum_squares += static_cast<double>(frame_time) * frame_time;
+}
+
+uint64_t FrameTimeStats::count() const
+{
+    return count_;
+}
+
+uint64_t FrameTimeStats::min() const
+{
+    return min_;
+}
+
+uint64_t FrameTimeStats::max() const
+{
+    return max_;
+}
+
+double FrameTimeStats::mean() const
+{
+    return count_ > 0 ? sum / count_ : 0.0;
+}
+
+double FrameTimeStats::stddev() const
+{
+    if (count_ < 2)
+        return 0.0;
+
+    auto const m = mean();
+    auto const variance = (sum_squares - count_ * m * m) / (count_ - 1);
+
+    return variance > 0.0 ? std::sqrt(variance) : 0.0;
+}
+
+double FrameTimeStats::percentile(double p) const
+{
+    if (count_ == 0)
+        return 0.0;
+
+    auto const clamped_p = std::clamp(p, 0.0, 100.0);
+    auto const rank = std::max<uint64_t>(
+        1, static_cast<uint64_t>(std::ceil(clamped_p / 100.0 * count_)));
+
+    uint64_t cumulative = 0;
+
+    for (size_t i = 0; i < buckets.size(); ++i)
+    {
+        cumulative += buckets[i];
+        if (cumulative >= rank)
+        {
+            return std::clamp(bucket_value(i),
+                              static_cast<double>(min_),
+                              static_cast<double>(max_));
+        }
+    }
+
+    return max_;
+}
+
+// Buckets [0, 2^sub_bucket_bits) hold exact values. After that, each power
+// of two range is split into 2^(sub_bucket_bits-1) equally sized buckets.
+size_t FrameTimeStats::bucket_index(uint64_t value)
+{
+    static uint64_t constexpr max_value = (uint64_t{1} << max_value_bits) - 1;
+    static size_t constexpr linear_buckets = 1u << sub_bucket_bits;
+    static size_t constexpr half_sub_buckets = 1u << (sub_bucket_bits - 1);
+
+    value = std::min(value, max_value);
+
+    if (value < linear_buckets)
+        return value;
+
+    auto const shift = floor_log2(value) - (sub_bucket_bits - 1);
+    auto const sub_bucket = (value >> shift) - half_sub_buckets;
+
+    return linear_buckets + (shift - 1) * half_sub_buckets + sub_bucket;
+}
+
+// Returns the midpoint of the value range covered by a bucket
+double FrameTimeStats::bucket_value(size_t index)
+{
+    static size_t constexpr linear_buckets = 1u << sub_bucket_bits;
+    static size_t constexpr half_sub_buckets = 1u << (sub_bucket_bits - 1);
+
+    if (index < linear_buckets)
+        return index;
+
+    auto const shift = (index - linear_buckets) / half_sub_buckets + 1;
+    auto const sub_bucket = (index - linear_buckets) % half_sub_buckets + half_sub_buckets;
+    auto const lower = static_cast<double>(uint64_t{sub_bucket} << shift);
+    auto const width = static_cast<double>(uint64_t{1} << shift);
+
+    return lower + (width - 1.0) / 2.0;
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// Records frame times (in integer units, e.g. microseconds) into a fixed-size
+// log-linear histogram, so that recording never allocates and memory use is
+// bounded regardless of the number of frames. Values below 256 are recorded
+// exactly, larger values with a relative error of less than 1%.
+class FrameTimeStats
+{
+public:
+    FrameTimeStats();
+
+    void reset();
+    void record(uint64_t frame_time);
+
+    uint64_t count() const;
+    uint64_t min() const;
+    uint64_t max() const;
+    double mean() const;
+    double stddev() const;
+    // p is in the range [0.0, 100.0]
+    double percentile(double p) const;
+
+private:
+    static unsigned int constexpr sub_bucket_bits = 8;
+    static unsigned int constexpr max_value_bits = 40;
+    static size_t constexpr num_buckets =
+        (1u << sub_bucket_bits) +
+        (max_value_bits - sub_bucket_bits) * (1u << (sub_bucket_bits - 1));
+
+    static size_t bucket_index(uint64_t value);
+    static double bucket_value(size_t index);
+
+    std::array<uint32_t, num_buckets> buckets;
+    uint64_t count_;
+    uint64_t min_;
+    uint64_t max_;
+    double sum;
+    double sum_squares;
+};
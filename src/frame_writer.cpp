@@ -0,0 +1,216 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "frame_writer.h"
+#include "util.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+std::string to_string(CaptureFormat format)
+{
+    switch (format)
+    {
+        case CaptureFormat::png: return "png";
+        case CaptureFormat::y4m: return "y4m";
+    }
+
+    return "";
+}
+
+FrameWriter::FrameWriter(CaptureFormat format, size_t max_queued_frames)
+    : format{format},
+      max_queued_frames{std::max<size_t>(max_queued_frames, 1)},
+      writing{false},
+      close_requested{false},
+      should_stop{false},
+      frames_written_{0},
+      wait_time_{0}
+{
+    thread = std::thread{[this] { run(); }};
+}
+
+FrameWriter::~FrameWriter()
+{
+    {
+        std::lock_guard<std::mutex> const lock{mutex};
+        should_stop = true;
+    }
+    queue_cv.notify_one();
+    thread.join();
+}
+
+void FrameWriter::write(std::string const& stem, uint64_t frame,
+                        size_t width, size_t height, std::vector<unsigned char> rgba)
+{
+    std::unique_lock<std::mutex> lock{mutex};
+
+    if (queue.size() >= max_queued_frames)
+    {
+        auto const wait_start = Util::get_timestamp_us();
+        done_cv.wait(lock, [this] { return queue.size() < max_queued_frames; });
+        wait_time_ += Util::get_timestamp_us() - wait_start;
+    }
+
+    queue.push_back({stem, frame, width, height, std::move(rgba)});
+    queue_cv.notify_one();
+}
+
+void FrameWriter::flush()
+{
+    std::unique_lock<std::mutex> lock{mutex};
+
+    close_requested = true;
+    queue_cv.notify_one();
+    done_cv.wait(lock, [this] { return queue.empty() && !writing && !close_requested; });
+
+    if (error)
+    {
+        auto const e = error;
+        error = nullptr;
+        std::rethrow_exception(e);
+    }
+}
+
+uint64_t FrameWriter::frames_written() const
+{
+    std::lock_guard<std::mutex> const lock{mutex};
+    return frames_written_;
+}
+
+uint64_t FrameWriter::wait_time() const
+{
+    std::lock_guard<std::mutex> const lock{mutex};
+    return wait_time_;
+}
+
+void FrameWriter::reset_stats()
+{
+    std::lock_guard<std::mutex> const lock{mutex};
+    frames_written_ = 0;
+    wait_time_ = 0;
+}
+
+void FrameWriter::run()
+{
+    std::unique_lock<std::mutex> lock{mutex};
+
+    while (true)
+    {
+        queue_cv.wait(lock, [this] { return !queue.empty() || close_requested || should_stop; });
+
+        // Queued frames are always written, even when stopping
+        if (!queue.empty())
+        {
+            auto const frame = std::move(queue.front());
+            queue.pop_front();
+            writing = true;
+            done_cv.notify_all();
+
+            lock.unlock();
+            std::exception_ptr frame_error;
+            try
+            {
+                write_frame(frame);
+            }
+            catch (...)
+            {
+                frame_error = std::current_exception();
+            }
+            lock.lock();
+
+            writing = false;
+            if (frame_error && !error)
+                error = frame_error;
+            else if (!frame_error)
+                ++frames_written_;
+            done_cv.notify_all();
+        }
+        else if (close_requested)
+        {
+            video.close();
+            video_stem.clear();
+            close_requested = false;
+            done_cv.notify_all();
+        }
+        else if (should_stop)
+        {
+            break;
+        }
+    }
+}
+
+void FrameWriter::write_frame(Frame const& frame)
+{
+    if (format == CaptureFormat::y4m)
+    {
+        write_y4m_frame(frame);
+    }
+    else
+    {
+        Util::write_png_file(frame.stem + "-frame" + std::to_string(frame.frame) + ".png",
+                             frame.rgba.data(), frame.width, frame.height);
+    }
+}
+
+void FrameWriter::write_y4m_frame(Frame const& frame)
+{
+    auto const path = frame.stem + ".y4m";
+
+    if (frame.stem != video_stem)
+    {
+        video.close();
+        video_stem.clear();
+        video.clear();
+        video.open(path, std::ios::binary | std::ios::trunc);
+        if (!video)
+            throw std::runtime_error{"Failed to open video file " + path};
+
+        // The frame rate is nominal, as frames are captured selectively
+        video << "YUV4MPEG2 W" << frame.width << " H" << frame.height
+              << " F60:1 Ip A1:1 C444 XCOLORRANGE=FULL\n";
+        video_stem = frame.stem;
+    }
+
+    auto const num_pixels = frame.width * frame.height;
+    yuv.resize(3 * num_pixels);
+
+    auto const clamp = [](int v) { return static_cast<unsigned char>(std::clamp(v, 0, 255)); };
+
+    // BT.601 full range conversion, with 8-bit fixed point coefficients.
+    // The chroma offset of 128 is added before shifting, to only shift
+    // non-negative values.
+    for (size_t i = 0; i < num_pixels; ++i)
+    {
+        int const r = frame.rgba[4 * i];
+        int const g = frame.rgba[4 * i + 1];
+        int const b = frame.rgba[4 * i + 2];
+
+        yuv[i] = clamp((77 * r + 150 * g + 29 * b + 128) >> 8);
+        yuv[num_pixels + i] = clamp((-43 * r - 85 * g + 128 * b + 32896) >> 8);
+        yuv[2 * num_pixels + i] = clamp((128 * r - 107 * g - 21 * b + 32896) >> 8);
+    }
+
+    video << "FRAME\n";
+    video.write(reinterpret_cast<char const*>(yuv.data()), yuv.size());
+
+    if (!video)
+        throw std::runtime_error{"Failed to write video file " + path};
+}
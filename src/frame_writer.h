@@ -0,0 +1,98 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+enum class CaptureFormat { png, y4m };
+
+std::string to_string(CaptureFormat format);
+
+// Writes captured frames to disk on a background thread, so that encoding
+// and file I/O don't stall the rendering thread. Frames are written as PNG
+// files named "<stem>-frame<N>.png", or appended to a Y4M (YUV4MPEG2) video
+// file named "<stem>.y4m", with full range BT.601 YUV 4:4:4 pixels.
+class FrameWriter
+{
+public:
+    FrameWriter(CaptureFormat format, size_t max_queued_frames);
+    ~FrameWriter();
+
+    // Queues a frame of tightly packed RGBA8 pixels, to be written to a
+    // file with the given path stem. Waits while max_queued_frames frames
+    // are already queued.
+    void write(std::string const& stem, uint64_t frame,
+               size_t width, size_t height, std::vector<unsigned char> rgba);
+
+    // Waits until all queued frames have been written and closes the
+    // video file. Rethrows the first error of the writer thread since the
+    // last flush().
+    void flush();
+
+    uint64_t frames_written() const;
+    // Total time in microseconds write() spent waiting for space in the
+    // queue since the last reset_stats()
+    uint64_t wait_time() const;
+    void reset_stats();
+
+private:
+    struct Frame
+    {
+        std::string stem;
+        uint64_t frame;
+        size_t width;
+        size_t height;
+        std::vector<unsigned char> rgba;
+    };
+
+    void run();
+    void write_frame(Frame const& frame);
+    void write_y4m_frame(Frame const& frame);
+
+    CaptureFormat const format;
+    size_t const max_queued_frames;
+
+    std::thread thread;
+    mutable std::mutex mutex;
+    std::condition_variable queue_cv;
+    std::condition_variable done_cv;
+    std::deque<Frame> queue;
+    // Whether a frame is being written, outside the queue
+    bool writing;
+    bool close_requested;
+    bool should_stop;
+    std::exception_ptr error;
+    uint64_t frames_written_;
+    uint64_t wait_time_;
+
+    // Only accessed by the writer thread
+    std::ofstream video;
+    std::string video_stem;
+    std::vector<unsigned char> yuv;
+};
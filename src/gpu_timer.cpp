@@ -0,0 +1,100 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gpu_timer.h"
+
+#include "vulkan_state.h"
+
+#include <array>
+
+namespace
+{
+
+uint32_t timestamp_valid_bits(VulkanState& vulkan)
+{
+    auto const queue_families = vulkan.physical_device().getQueueFamilyProperties();
+    return queue_families[vulkan.graphics_queue_family_index()].timestampValidBits;
+}
+
+}
+
+GPUTimer::GPUTimer(VulkanState& vulkan, uint32_t num_slots)
+    : vulkan{vulkan},
+      slot_submitted(num_slots, false)
+{
+    auto const query_pool_create_info = vk::QueryPoolCreateInfo{}
+        .setQueryType(vk::QueryType::eTimestamp)
+        .setQueryCount(2 * num_slots);
+
+    query_pool = ManagedResource<vk::QueryPool>{
+        vulkan.device().createQueryPool(query_pool_create_info),
+        [vptr=&vulkan] (auto const& qp) { vptr->device().destroyQueryPool(qp); }};
+
+    auto const valid_bits = timestamp_valid_bits(vulkan);
+    timestamp_mask = valid_bits >= 64 ? UINT64_MAX : (uint64_t{1} << valid_bits) - 1;
+    timestamp_period = vulkan.physical_device().getProperties().limits.timestampPeriod;
+}
+
+bool GPUTimer::is_supported(VulkanState& vulkan)
+{
+    return timestamp_valid_bits(vulkan) > 0;
+}
+
+void GPUTimer::write_start(vk::CommandBuffer const& command_buffer, uint32_t slot)
+{
+    command_buffer.resetQueryPool(query_pool, 2 * slot, 2);
+    command_buffer.writeTimestamp(vk::PipelineStageFlagBits::eTopOfPipe,
+                                  query_pool, 2 * slot);
+}
+
+void GPUTimer::write_end(vk::CommandBuffer const& command_buffer, uint32_t slot)
+{
+    command_buffer.writeTimestamp(vk::PipelineStageFlagBits::eBottomOfPipe,
+                                  query_pool, 2 * slot + 1);
+}
+
+std::optional<uint64_t> GPUTimer::collect(uint32_t slot)
+{
+    std::optional<uint64_t> ret;
+
+    // Queries that have never been submitted are in an undefined state
+    // and must not be read back.
+    if (slot_submitted[slot])
+    {
+        // Each query result is followed by its availability value
+        std::array<uint64_t, 4> results{};
+
+        auto const result = vulkan.device().getQueryPoolResults(
+            query_pool, 2 * slot, 2,
+            sizeof(results), results.data(), 2 * sizeof(uint64_t),
+            vk::QueryResultFlagBits::e64 | vk::QueryResultFlagBits::eWithAvailability);
+
+        if (result == vk::Result::eSuccess && results[1] && results[3])
+        {
+            auto const start = results[0] & timestamp_mask;
+            auto const end = results[2] & timestamp_mask;
+            auto const ticks = (end - start) & timestamp_mask;
+            ret = static_cast<uint64_t>(ticks * timestamp_period);
+        }
+    }
+
+    slot_submitted[slot] = true;
+
+    return ret;
+}
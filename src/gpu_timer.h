@@ -0,0 +1,56 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "managed_resource.h"
+
+#include <optional>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+class VulkanState;
+
+// Measures the GPU execution time of command buffers using a pair of
+// timestamp queries per slot (usually one slot per swapchain image). Results
+// are read back without waiting, just before a slot is reused, so they are
+// delayed by as many frames as there are slots.
+class GPUTimer
+{
+public:
+    GPUTimer(VulkanState& vulkan, uint32_t num_slots);
+
+    static bool is_supported(VulkanState& vulkan);
+
+    void write_start(vk::CommandBuffer const& command_buffer, uint32_t slot);
+    void write_end(vk::CommandBuffer const& command_buffer, uint32_t slot);
+
+    // Returns the GPU time in nanoseconds of the last submission that
+    // used the slot, if available. Must be called before each submission
+    // of a command buffer that uses the slot.
+    std::optional<uint64_t> collect(uint32_t slot);
+
+private:
+    VulkanState& vulkan;
+    ManagedResource<vk::QueryPool> query_pool;
+    std::vector<bool> slot_submitted;
+    uint64_t timestamp_mask;
+    double timestamp_period;
+};
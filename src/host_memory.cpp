@@ -0,0 +1,64 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "host_memory.h"
+
+#include <fstream>
+#include <sstream>
+
+uint64_t HostMemory::status_field_bytes(std::string const& status_file,
+                                        std::string const& name)
+{
+    std::ifstream ifs{status_file};
+    std::string line;
+    auto const prefix = name + ":";
+
+    while (std::getline(ifs, line))
+    {
+        if (line.compare(0, prefix.size(), prefix) != 0)
+            continue;
+
+        std::stringstream ss{line.substr(prefix.size())};
+        uint64_t value = 0;
+        std::string unit;
+        ss >> value >> unit;
+
+        return unit == "kB" ? value * 1024 : value;
+    }
+
+    return 0;
+}
+
+uint64_t HostMemory::current_rss()
+{
+    return status_field_bytes("/proc/self/status", "VmRSS");
+}
+
+uint64_t HostMemory::peak_rss()
+{
+    return status_field_bytes("/proc/self/status", "VmHWM");
+}
+
+bool HostMemory::reset_peak_rss()
+{
+    // Writing 5 to clear_refs resets the peak RSS (Linux 4.0+)
+    std::ofstream ofs{"/proc/self/clear_refs"};
+    ofs << "5" << std::flush;
+    return static_cast<bool>(ofs);
+}
@@ -0,0 +1,38 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+// Resident set size of the process, read from /proc/self
+namespace HostMemory
+{
+
+uint64_t current_rss();
+// Highest RSS since process start or the last reset_peak_rss()
+uint64_t peak_rss();
+// Returns false if the kernel doesn't support resetting the peak
+bool reset_peak_rss();
+
+// Returns the value in bytes of a "Name:   123 kB" field of a status file
+uint64_t status_field_bytes(std::string const& status_file, std::string const& name);
+
+}
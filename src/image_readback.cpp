@@ -0,0 +1,238 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "image_readback.h"
+
+#include "vulkan_state.h"
+#include "vkutil/vkutil.h"
+
+#include <algorithm>
+#include <mutex>
+#include <stdexcept>
+
+namespace
+{
+
+bool is_bgra(vk::Format format)
+{
+    return format == vk::Format::eB8G8R8A8Unorm ||
+           format == vk::Format::eB8G8R8A8Srgb;
+}
+
+}
+
+ImageReadback::ImageReadback(VulkanState& vulkan, vk::Extent2D extent, vk::Format format)
+    : vulkan{vulkan},
+      vk_extent{extent},
+      vk_format{format},
+      size{4ull * extent.width * extent.height},
+      mapped{nullptr},
+      submitted{false}
+{
+    if (!is_format_supported(format))
+    {
+        throw std::runtime_error{
+            "Image readback doesn't support format " + to_string(format)};
+    }
+
+    vk::DeviceMemory memory;
+
+    vk_buffer = vkutil::BufferBuilder{vulkan}
+        .set_size(size)
+        .set_usage(vk::BufferUsageFlagBits::eTransferDst)
+        .set_memory_properties(vk::MemoryPropertyFlagBits::eHostVisible |
+                               vk::MemoryPropertyFlagBits::eHostCoherent)
+        .set_memory_out(memory)
+        .build();
+
+    vk_memory_map = vkutil::map_memory(vulkan, memory, 0, size);
+    mapped = static_cast<unsigned char const*>(vk_memory_map.raw);
+
+    auto const command_buffer_allocate_info = vk::CommandBufferAllocateInfo{}
+        .setCommandPool(vulkan.command_pool())
+        .setCommandBufferCount(1)
+        .setLevel(vk::CommandBufferLevel::ePrimary);
+
+    vk_command_buffer = ManagedResource<vk::CommandBuffer>{
+        std::move(vulkan.device().allocateCommandBuffers(command_buffer_allocate_info)[0]),
+        [vptr=&vulkan] (auto const& c)
+        {
+            vptr->device().freeCommandBuffers(vptr->command_pool(), c);
+        }};
+
+    vk_fence = ManagedResource<vk::Fence>{
+        vulkan.device().createFence(vk::FenceCreateInfo{}),
+        [vptr=&vulkan] (auto const& f) { vptr->device().destroyFence(f); }};
+
+    vk_semaphore = ManagedResource<vk::Semaphore>{
+        vulkan.device().createSemaphore(vk::SemaphoreCreateInfo{}),
+        [vptr=&vulkan] (auto const& s) { vptr->device().destroySemaphore(s); }};
+}
+
+ImageReadback::~ImageReadback()
+{
+    // The resources must not be in use when destroyed
+    wait();
+}
+
+bool ImageReadback::is_format_supported(vk::Format format)
+{
+    return is_bgra(format) ||
+           format == vk::Format::eR8G8B8A8Unorm ||
+           format == vk::Format::eR8G8B8A8Srgb;
+}
+
+VulkanImage ImageReadback::submit(VulkanImage const& image)
+{
+    wait();
+
+    auto const image_range = vk::ImageSubresourceRange{}
+        .setAspectMask(vk::ImageAspectFlagBits::eColor)
+        .setBaseMipLevel(0)
+        .setLevelCount(1)
+        .setBaseArrayLayer(0)
+        .setLayerCount(1);
+
+    auto const present_to_transfer_barrier = vk::ImageMemoryBarrier{}
+        .setImage(image.image)
+        .setOldLayout(vk::ImageLayout::ePresentSrcKHR)
+        .setNewLayout(vk::ImageLayout::eTransferSrcOptimal)
+        .setSrcAccessMask(vk::AccessFlagBits::eMemoryWrite)
+        .setDstAccessMask(vk::AccessFlagBits::eTransferRead)
+        .setSrcQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
+        .setDstQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
+        .setSubresourceRange(image_range);
+
+    auto const transfer_to_present_barrier = vk::ImageMemoryBarrier{}
+        .setImage(image.image)
+        .setOldLayout(vk::ImageLayout::eTransferSrcOptimal)
+        .setNewLayout(vk::ImageLayout::ePresentSrcKHR)
+        .setSrcAccessMask({})
+        .setDstAccessMask({})
+        .setSrcQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
+        .setDstQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
+        .setSubresourceRange(image_range);
+
+    auto const host_read_barrier = vk::BufferMemoryBarrier{}
+        .setBuffer(vk_buffer)
+        .setOffset(0)
+        .setSize(VK_WHOLE_SIZE)
+        .setSrcAccessMask(vk::AccessFlagBits::eTransferWrite)
+        .setDstAccessMask(vk::AccessFlagBits::eHostRead)
+        .setSrcQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
+        .setDstQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED);
+
+    auto const copy_region = vk::BufferImageCopy{}
+        .setBufferOffset(0)
+        .setBufferRowLength(0)
+        .setBufferImageHeight(0)
+        .setImageSubresource(
+            vk::ImageSubresourceLayers{}
+                .setAspectMask(vk::ImageAspectFlagBits::eColor)
+                .setMipLevel(0)
+                .setBaseArrayLayer(0)
+                .setLayerCount(1))
+        .setImageOffset({0, 0, 0})
+        .setImageExtent({vk_extent.width, vk_extent.height, 1});
+
+    vk::CommandBuffer& command_buffer = vk_command_buffer;
+
+    command_buffer.begin(vk::CommandBufferBeginInfo{}
+        .setFlags(vk::CommandBufferUsageFlagBits::eOneTimeSubmit));
+
+    // Scenes finish rendering with various stages and accesses, so wait
+    // for all of them
+    command_buffer.pipelineBarrier(
+        vk::PipelineStageFlagBits::eAllCommands,
+        vk::PipelineStageFlagBits::eTransfer,
+        {}, {}, {},
+        present_to_transfer_barrier);
+
+    command_buffer.copyImageToBuffer(
+        image.image, vk::ImageLayout::eTransferSrcOptimal, vk_buffer, copy_region);
+
+    // Later rendering to the image must not start before the copy is done
+    command_buffer.pipelineBarrier(
+        vk::PipelineStageFlagBits::eTransfer,
+        vk::PipelineStageFlagBits::eColorAttachmentOutput |
+            vk::PipelineStageFlagBits::eTransfer |
+            vk::PipelineStageFlagBits::eHost,
+        {}, {}, host_read_barrier,
+        transfer_to_present_barrier);
+
+    command_buffer.end();
+
+    vk::PipelineStageFlags const wait_stage = vk::PipelineStageFlagBits::eAllCommands;
+
+    auto const submit_info = vk::SubmitInfo{}
+        .setCommandBufferCount(1)
+        .setPCommandBuffers(&command_buffer)
+        .setWaitSemaphoreCount(image.semaphore ? 1 : 0)
+        .setPWaitSemaphores(&image.semaphore)
+        .setPWaitDstStageMask(&wait_stage)
+        .setSignalSemaphoreCount(image.semaphore ? 1 : 0)
+        .setPSignalSemaphores(&vk_semaphore.raw);
+
+    {
+        std::lock_guard<std::mutex> const lock{vulkan.queue_mutex()};
+        vulkan.graphics_queue().submit(submit_info, vk_fence);
+    }
+
+    submitted = true;
+
+    return image.semaphore ? image.copy_with_semaphore(vk_semaphore) : image;
+}
+
+bool ImageReadback::is_complete() const
+{
+    return !submitted ||
+           vulkan.device().getFenceStatus(vk_fence) == vk::Result::eSuccess;
+}
+
+std::vector<unsigned char> ImageReadback::rgba()
+{
+    wait();
+
+    std::vector<unsigned char> data{mapped, mapped + size};
+
+    if (is_bgra(vk_format))
+    {
+        for (size_t i = 0; i < data.size(); i += 4)
+            std::swap(data[i], data[i + 2]);
+    }
+
+    return data;
+}
+
+vk::Extent2D ImageReadback::extent() const
+{
+    return vk_extent;
+}
+
+void ImageReadback::wait()
+{
+    if (!submitted)
+        return;
+
+    (void)vulkan.device().waitForFences(vk_fence.raw, true, UINT64_MAX);
+    vulkan.device().resetFences(vk_fence.raw);
+    vk_command_buffer.raw.reset(vk::CommandBufferResetFlags{});
+    submitted = false;
+}
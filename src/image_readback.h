@@ -0,0 +1,75 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "managed_resource.h"
+#include "vulkan_image.h"
+
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+class VulkanState;
+
+// Copies rendered images to a host visible buffer for inspection. The copy
+// is submitted after the rendering of the image without waiting for it on
+// the CPU. If the image has a semaphore to present with, the copy waits
+// for it and the returned image has a semaphore signaled by the copy
+// instead, so the copy finishes before presentation.
+//
+// Only 8-bit RGBA and BGRA formats are supported.
+class ImageReadback
+{
+public:
+    ImageReadback(VulkanState& vulkan, vk::Extent2D extent, vk::Format format);
+    ~ImageReadback();
+
+    static bool is_format_supported(vk::Format format);
+
+    // Submits the copy of the image, waiting first for the previous copy
+    // of this readback to complete. Returns the image to present.
+    VulkanImage submit(VulkanImage const& image);
+
+    // Whether the last submitted copy has completed
+    bool is_complete() const;
+    // Waits for the last submitted copy, if any
+    void wait();
+
+    // Waits for the last submitted copy, if any, and returns its pixels as
+    // tightly packed RGBA8 data
+    std::vector<unsigned char> rgba();
+
+    vk::Extent2D extent() const;
+
+private:
+    VulkanState& vulkan;
+    vk::Extent2D const vk_extent;
+    vk::Format const vk_format;
+    vk::DeviceSize const size;
+
+    ManagedResource<vk::Buffer> vk_buffer;
+    ManagedResource<void*> vk_memory_map;
+    ManagedResource<vk::CommandBuffer> vk_command_buffer;
+    ManagedResource<vk::Fence> vk_fence;
+    ManagedResource<vk::Semaphore> vk_semaphore;
+    unsigned char const* mapped;
+    bool submitted;
+};
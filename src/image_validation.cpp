@@ -0,0 +1,139 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "image_validation.h"
+#include "log.h"
+#include "util.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+
+uint64_t ImageValidation::hash(unsigned char const* rgba, size_t width, size_t height)
+{
+    uint64_t h = 0xcbf29ce484222325ull;
+
+    for (size_t i = 0; i < width * height; ++i)
+    {
+        for (size_t c = 0; c < 3; ++c)
+        {
+            h ^= rgba[4 * i + c];
+            h *= 0x100000001b3ull;
+        }
+    }
+
+    return h;
+}
+
+std::string ImageValidation::hash_string(uint64_t hash)
+{
+    char buf[17];
+    std::snprintf(buf, sizeof(buf), "%016llx", static_cast<unsigned long long>(hash));
+    return buf;
+}
+
+std::string ImageValidation::reference_file_name(std::string const& description,
+                                                 unsigned int frame)
+{
+    return Results::file_stem(description) + "-frame" + std::to_string(frame) + ".png";
+}
+
+ImageValidationResult ImageValidation::validate(
+    unsigned char const* rgba, size_t width, size_t height,
+    std::string const& path, unsigned int tolerance)
+{
+    ImageValidationResult result{false, true, hash(rgba, width, height), 0, 0};
+
+    if (!std::ifstream{path})
+    {
+        Util::write_png_file(path, rgba, width, height);
+        result.reference_written = true;
+        return result;
+    }
+
+    auto const reference = Util::load_image_file(path);
+
+    if (reference.width != width || reference.height != height)
+    {
+        Log::debug("ImageValidation: Reference image %s is %zux%zu, expected %zux%zu\n",
+                   path.c_str(), reference.width, reference.height, width, height);
+        result.valid = false;
+        result.mismatched_pixels = width * height;
+        result.max_difference = 255;
+        return result;
+    }
+
+    for (size_t i = 0; i < width * height; ++i)
+    {
+        unsigned int pixel_difference = 0;
+
+        for (size_t c = 0; c < 3; ++c)
+        {
+            auto const difference = static_cast<unsigned int>(
+                std::abs(rgba[4 * i + c] - reference.data[4 * i + c]));
+            pixel_difference = std::max(pixel_difference, difference);
+        }
+
+        if (pixel_difference > tolerance)
+            ++result.mismatched_pixels;
+        result.max_difference = std::max(result.max_difference, pixel_difference);
+    }
+
+    result.valid = result.mismatched_pixels == 0;
+
+    return result;
+}
+
+bool ImageValidation::has_failures(std::vector<BenchmarkResult> const& results)
+{
+    return std::any_of(results.begin(), results.end(),
+                       [](auto const& r) { return r.has_validation && !r.valid; });
+}
+
+void ImageValidation::log(std::vector<BenchmarkResult> const& results)
+{
+    unsigned int num_invalid = 0;
+
+    Log::info("    Image validation\n");
+
+    for (auto const& r : results)
+    {
+        if (!r.has_validation)
+        {
+            Log::info("%s: <not validated>\n", r.description.c_str());
+            continue;
+        }
+
+        if (r.valid)
+        {
+            Log::info("%s: Hash: %s OK\n", r.description.c_str(), r.image_hash.c_str());
+        }
+        else
+        {
+            Log::info("%s: Hash: %s MISMATCH (%llu pixels)\n",
+                      r.description.c_str(), r.image_hash.c_str(),
+                      static_cast<unsigned long long>(r.mismatched_pixels));
+            ++num_invalid;
+        }
+    }
+
+    Log::info("    Mismatches: %u\n", num_invalid);
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "results.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct ImageValidationResult
+{
+    // Whether there was no reference image, so the image was written as
+    // the new reference
+    bool reference_written;
+    bool valid;
+    uint64_t hash;
+    // Pixels with a channel that differs from the reference by more than
+    // the tolerance
+    uint64_t mismatched_pixels;
+    unsigned int max_difference;
+};
+
+// Validation of rendered frames against reference images, to detect
+// drivers that skip or corrupt rendering work. Images are tightly packed
+// RGBA8 pixel data. Alpha is ignored, as it is not meaningful for
+// presentable images.
+namespace ImageValidation
+{
+
+// 64-bit FNV-1a hash of the color channels
+uint64_t hash(unsigned char const* rgba, size_t width, size_t height);
+std::string hash_string(uint64_t hash);
+
+// The reference image file name for a frame of a benchmark (e.g.
+// "cube_present=thread-frame10.png"), see Results::file_stem()
+std::string reference_file_name(std::string const& description, unsigned int frame);
+
+// Compares the image with the reference image file at path, which is
+// written from the image if it doesn't exist. Channels that differ by at
+// most tolerance are considered equal.
+ImageValidationResult validate(unsigned char const* rgba, size_t width, size_t height,
+                               std::string const& path, unsigned int tolerance);
+
+bool has_failures(std::vector<BenchmarkResult> const& results);
+
+void log(std::vector<BenchmarkResult> const& results);
+
+}
@@ -32,35 +32,59 @@
 #include "log.h"
 #include "util.h"
 #include "main_loop.h"
+#include "multi_tenant_loop.h"
+#include "offscreen_window_system.h"
+#include "results.h"
+#include "async_compute_speedup.h"
+#include "present_speedup.h"
+#include "baseline_comparison.h"
+#include "device_comparison.h"
+#include "device_selector.h"
+#include "image_validation.h"
+#include "trace.h"
+#include "setup_timing.h"
+#include "thread_scaling.h"
 
 #include "scenes/clear_scene.h"
+#include "scenes/compute_scene.h"
 #include "scenes/cube_scene.h"
 #include "scenes/default_options_scene.h"
 #include "scenes/desktop_scene.h"
 #include "scenes/effect2d_scene.h"
+#include "scenes/multithread_scene.h"
 #include "scenes/shading_scene.h"
 #include "scenes/texture_scene.h"
 #include "scenes/vertex_scene.h"
 
 #include <stdexcept>
+#include <atomic>
 #include <csignal>
 #include <memory>
 #include <iostream>
+#include <algorithm>
+#include <cctype>
 
 namespace
 {
 
 MainLoop* main_loop_global = nullptr;
+MultiTenantLoop* multi_tenant_loop_global = nullptr;
+std::atomic<bool> stop_requested{false};
+
+// Fixed animation time step of validated runs, as for 60 FPS
+char const* const validate_timestep = "0.016667";
 
 void sighandler(int)
 {
-    main_loop_global->stop();
+    stop_requested = true;
+    if (main_loop_global)
+        main_loop_global->stop();
+    if (multi_tenant_loop_global)
+        multi_tenant_loop_global->stop();
 }
 
-void set_up_sighandler(MainLoop& main_loop)
+void set_up_sighandler()
 {
-    main_loop_global = &main_loop;
-
     struct sigaction sa{};
     sa.sa_handler = sighandler;
 
@@ -68,18 +92,325 @@ void set_up_sighandler(MainLoop& main_loop)
     sigaction(SIGINT, &sa, nullptr);
 }
 
+RunInfo get_run_info(VulkanState const& vulkan,
+                     std::string const& window_system,
+                     SetupTiming const& startup_timing,
+                     Options const& options)
+{
+    auto const props = vulkan.physical_device().getProperties();
+    RunInfo run_info{};
+
+    run_info.vkmark_version = VKMARK_VERSION_STR;
+    run_info.window_system = window_system;
+    run_info.present_mode = to_string(options.present_mode);
+    std::transform(run_info.present_mode.begin(), run_info.present_mode.end(),
+                   run_info.present_mode.begin(),
+                   [](auto c) { return std::tolower(c); });
+    run_info.vendor_id = props.vendorID;
+    run_info.device_id = props.deviceID;
+    run_info.device_name = static_cast<char const*>(props.deviceName);
+    run_info.driver_version = props.driverVersion;
+    run_info.device_uuid =
+        static_cast<DeviceUUID>(props.pipelineCacheUUID).representation().data();
+    run_info.score_method = to_string(options.score_method);
+    run_info.startup_phases = startup_timing.phases();
+
+    return run_info;
+}
+
+void log_score(ScoreMethod method, double score)
+{
+    switch (method)
+    {
+        case ScoreMethod::fps:
+            Log::info("                                   vkmark Score: %u\n",
+                      static_cast<unsigned int>(score));
+            break;
+        case ScoreMethod::frametime:
+            Log::info("                     vkmark Score (frametime): %.3f ms\n",
+                      score);
+            break;
+        default:
+            Log::info("                     vkmark Score (%s): %.2f\n",
+                      to_string(method).c_str(), score);
+            break;
+    }
+}
+
+void log_startup_timing(SetupTiming const& startup_timing)
+{
+    Log::info("    Startup Time:   %.3f ms\n", startup_timing.total() / 1000.0);
+
+    for (auto const& phase : startup_timing.phases())
+        Log::info("        %s: %.3f ms\n", phase.name.c_str(), phase.duration / 1000.0);
+}
+
 void populate_scene_collection(SceneCollection& sc)
 {
     sc.register_scene(std::make_unique<ClearScene>());
+    sc.register_scene(std::make_unique<ComputeScene>());
     sc.register_scene(std::make_unique<CubeScene>());
     sc.register_scene(std::make_unique<DefaultOptionsScene>(sc));
     sc.register_scene(std::make_unique<DesktopScene>());
     sc.register_scene(std::make_unique<Effect2DScene>());
+    sc.register_scene(std::make_unique<MultithreadScene>());
     sc.register_scene(std::make_unique<ShadingScene>());
     sc.register_scene(std::make_unique<TextureScene>());
     sc.register_scene(std::make_unique<VertexScene>());
 }
 
+// What is shared by the runs on each device
+struct RunContext
+{
+    Options const& options;
+    WindowSystemLoader const& ws_loader;
+    WindowSystem& ws;
+    BenchmarkCollection& bc;
+    std::vector<BenchmarkResult> const& baseline;
+    std::vector<BenchmarkResult> const& score_reference;
+};
+
+// The devices to run the benchmarks on, empty to use the first supported
+// device
+std::vector<DeviceDescription> select_devices(Options const& options)
+{
+    if (!options.all_devices && options.use_device.empty())
+        return {};
+
+    auto const devices =
+        DeviceSelector{options.use_device}.select(VulkanState::describe_all_devices());
+
+    if (devices.empty() && options.use_device.empty())
+        throw std::runtime_error{"No Vulkan devices found"};
+    if (devices.empty())
+        throw std::runtime_error{"No Vulkan devices match '" + options.use_device + "'"};
+
+    if (!options.all_devices)
+        return {devices.front()};
+
+    return devices;
+}
+
+// Inserts the device index before the extension, e.g. results-device1.json
+std::string device_results_file(std::string const& file, uint32_t index)
+{
+    auto const suffix = "-device" + std::to_string(index);
+    auto const slash = file.rfind('/');
+    auto const dot = file.rfind('.');
+
+    if (dot == std::string::npos || (slash != std::string::npos && dot < slash))
+        return file + suffix;
+
+    return file.substr(0, dot) + suffix + file.substr(dot);
+}
+
+// Runs the benchmarks on the device of vulkan, filling in the results and
+// score of run. Returns whether the results regressed compared to the
+// baseline, or didn't match it.
+bool run_benchmarks(RunContext const& ctx, VulkanState& vulkan,
+                    std::string const& results_file, DeviceRun& run)
+{
+    auto const& options = ctx.options;
+    auto& ws = ctx.ws;
+
+    auto const ws_vulkan_deinit = Util::on_scope_exit([&] { ws.deinit_vulkan(); });
+    auto const init_vulkan_start = Util::get_timestamp_us();
+    ws.init_vulkan(vulkan);
+
+    SetupTiming startup_timing;
+    startup_timing.record(ctx.ws_loader.setup_timing());
+    startup_timing.record(vulkan.setup_timing());
+    startup_timing.record("init vulkan", Util::get_timestamp_us() - init_vulkan_start);
+
+    Log::info("=======================================================\n");
+    Log::info("    vkmark %s\n", VKMARK_VERSION_STR);
+    Log::info("=======================================================\n");
+    vulkan.log_info();
+    if (options.setup_times)
+        log_startup_timing(startup_timing);
+    Log::info("=======================================================\n");
+
+    MainLoop main_loop{vulkan, ws, ctx.bc, options};
+
+    main_loop.set_score_reference(ctx.score_reference);
+
+    main_loop_global = &main_loop;
+    auto const sighandler_reset = Util::on_scope_exit([] { main_loop_global = nullptr; });
+
+    main_loop.run();
+
+    run.results = main_loop.results();
+    run.score = main_loop.score();
+
+    Log::info("=======================================================\n");
+    log_score(options.score_method, run.score);
+    Log::info("=======================================================\n");
+
+    auto const thread_scaling = ThreadScaling::compute(run.results);
+    if (ThreadScaling::has_scaling(thread_scaling))
+    {
+        ThreadScaling::log(thread_scaling);
+        Log::info("=======================================================\n");
+    }
+
+    auto const async_compute_speedup = AsyncComputeSpeedup::compute(run.results);
+    if (!async_compute_speedup.empty())
+    {
+        AsyncComputeSpeedup::log(async_compute_speedup);
+        Log::info("=======================================================\n");
+    }
+
+    auto const present_speedup = PresentSpeedup::compute(run.results);
+    if (!present_speedup.empty())
+    {
+        PresentSpeedup::log(present_speedup);
+        Log::info("=======================================================\n");
+    }
+
+    if (!options.validate_dir.empty())
+    {
+        ImageValidation::log(run.results);
+        Log::info("=======================================================\n");
+    }
+
+    if (!results_file.empty())
+    {
+        Results::write_file(results_file, options.results_format,
+                            get_run_info(vulkan, ctx.ws_loader.window_system_name(),
+                                         startup_timing, options),
+                            run.results, run.score);
+    }
+
+    if (!options.compare_to.empty())
+    {
+        auto const comparisons = BaselineComparison::compare(
+            ctx.baseline, run.results, options.regression_threshold);
+
+        BaselineComparison::log(comparisons, options.regression_threshold);
+        Log::info("=======================================================\n");
+
+        return BaselineComparison::has_regressions(comparisons) ||
+               BaselineComparison::has_unmatched(comparisons);
+    }
+
+    return false;
+}
+
+// Runs options.tenants instances of the benchmarks concurrently, each with
+// its own offscreen window system, Vulkan state and scenes, on the first
+// selected device. Returns whether the results regressed compared to the
+// baseline, or didn't match it.
+bool run_tenants(Options const& options,
+                 std::vector<DeviceDescription> const& devices,
+                 std::vector<BenchmarkResult> const& baseline,
+                 std::vector<BenchmarkResult> const& score_reference)
+{
+    struct Tenant
+    {
+        std::unique_ptr<OffscreenWindowSystem> ws;
+        std::unique_ptr<VulkanState> vulkan;
+        std::unique_ptr<SceneCollection> sc;
+        std::unique_ptr<BenchmarkCollection> bc;
+    };
+
+    auto const extent = vk::Extent2D{
+        static_cast<uint32_t>(options.size.first > 0 ? options.size.first : 800),
+        static_cast<uint32_t>(options.size.second > 0 ? options.size.second : 600)};
+    auto const format = options.pixel_format != vk::Format::eUndefined ?
+                        options.pixel_format : vk::Format::eB8G8R8A8Srgb;
+    auto const device_strategy = devices.empty() ?
+        VulkanState::ChoosePhysicalDeviceStrategy{ChooseFirstSupportedStrategy{}} :
+        VulkanState::ChoosePhysicalDeviceStrategy{ChooseByIndexStrategy{devices.front().index}};
+
+    std::vector<Tenant> tenants;
+    auto const tenants_deinit = Util::on_scope_exit(
+        [&]
+        {
+            for (auto& tenant : tenants)
+            {
+                if (tenant.vulkan)
+                    tenant.ws->deinit_vulkan();
+            }
+        });
+
+    SetupTiming startup_timing;
+    auto const startup_start = Util::get_timestamp_us();
+
+    for (unsigned int i = 0; i < options.tenants; ++i)
+    {
+        Tenant tenant;
+        tenant.ws = std::make_unique<OffscreenWindowSystem>(extent, format, 3);
+        tenants.push_back(std::move(tenant));
+
+        auto& t = tenants.back();
+        t.vulkan = std::make_unique<VulkanState>(
+            t.ws->vulkan_wsi(), device_strategy, options.show_debug);
+        t.ws->init_vulkan(*t.vulkan);
+
+        t.sc = std::make_unique<SceneCollection>();
+        populate_scene_collection(*t.sc);
+        t.bc = std::make_unique<BenchmarkCollection>(*t.sc);
+        if (!options.benchmarks.empty())
+            t.bc->add(options.benchmarks);
+        if (!t.bc->contains_normal_scenes())
+            t.bc->add(DefaultBenchmarks::get());
+    }
+
+    startup_timing.record(tenants[0].vulkan->setup_timing());
+    startup_timing.record("tenants", Util::get_timestamp_us() - startup_start);
+
+    Log::info("=======================================================\n");
+    Log::info("    vkmark %s\n", VKMARK_VERSION_STR);
+    Log::info("=======================================================\n");
+    tenants[0].vulkan->log_info();
+    Log::info("    Tenants:        %u (offscreen %ux%u)\n",
+              options.tenants, extent.width, extent.height);
+    if (options.setup_times)
+        log_startup_timing(startup_timing);
+    Log::info("=======================================================\n");
+
+    std::vector<MultiTenantLoop::Tenant> loop_tenants;
+    for (auto& tenant : tenants)
+        loop_tenants.push_back({*tenant.vulkan, *tenant.ws, *tenant.bc});
+
+    MultiTenantLoop loop{loop_tenants, options};
+
+    loop.set_score_reference(score_reference);
+
+    multi_tenant_loop_global = &loop;
+    auto const sighandler_reset = Util::on_scope_exit([] { multi_tenant_loop_global = nullptr; });
+
+    loop.run();
+
+    auto const score = loop.score();
+
+    Log::info("=======================================================\n");
+    log_score(options.score_method, score);
+    Log::info("=======================================================\n");
+
+    if (!options.results_file.empty())
+    {
+        Results::write_file(options.results_file, options.results_format,
+                            get_run_info(*tenants[0].vulkan, "offscreen",
+                                         startup_timing, options),
+                            loop.results(), score);
+    }
+
+    if (!options.compare_to.empty())
+    {
+        auto const comparisons = BaselineComparison::compare(
+            baseline, loop.results(), options.regression_threshold);
+
+        BaselineComparison::log(comparisons, options.regression_threshold);
+        Log::info("=======================================================\n");
+
+        return BaselineComparison::has_regressions(comparisons) ||
+               BaselineComparison::has_unmatched(comparisons);
+    }
+
+    return false;
+}
+
 }
 
 int main(int argc, char **argv)
@@ -103,9 +434,27 @@ try
 
     Util::set_data_dir(options.data_dir);
 
+    // Read the baseline early, to avoid a full run with an unusable baseline
+    std::vector<BenchmarkResult> baseline;
+    if (!options.compare_to.empty())
+        baseline = Results::read_file(options.compare_to);
+
+    std::vector<BenchmarkResult> score_reference;
+    if (options.score_method == ScoreMethod::reference)
+    {
+        if (options.score_reference.empty())
+            throw std::runtime_error{"The reference score method requires --score-reference"};
+        score_reference = Results::read_file(options.score_reference);
+    }
+
     SceneCollection sc;
     populate_scene_collection(sc);
 
+    // Validated frames must not depend on the time taken to render the
+    // previous frames
+    if (!options.validate_dir.empty())
+        sc.set_option_default("timestep", validate_timestep);
+
     BenchmarkCollection bc{sc};
 
     if (options.list_scenes)
@@ -120,21 +469,33 @@ try
         return 0;
     }
 
-    auto& ws = ws_loader.load_window_system();
+    auto const devices = select_devices(options);
 
-    auto&& device_strategy = options.use_device_with_uuid ?
-        VulkanState::ChoosePhysicalDeviceStrategy{ChooseByUUIDStrategy{*options.use_device_with_uuid}} :
-        VulkanState::ChoosePhysicalDeviceStrategy{ChooseFirstSupportedStrategy{}};
-    VulkanState vulkan{ws.vulkan_wsi(), device_strategy, options.show_debug};
+    set_up_sighandler();
 
-    auto const ws_vulkan_deinit = Util::on_scope_exit([&] { ws.deinit_vulkan(); });
-    ws.init_vulkan(vulkan);
+    if (options.tenants > 1)
+    {
+        if (options.all_devices)
+            throw std::runtime_error{"--tenants can't be combined with --all-devices"};
+        if (!options.validate_dir.empty())
+            throw std::runtime_error{"--tenants can't be combined with --validate"};
+        if (!options.capture_frames.empty())
+            throw std::runtime_error{"--tenants can't be combined with --capture-frames"};
+        if (options.run_forever)
+            throw std::runtime_error{"--tenants can't be combined with --run-forever"};
 
-    Log::info("=======================================================\n");
-    Log::info("    vkmark %s\n", VKMARK_VERSION_STR);
-    Log::info("=======================================================\n");
-    vulkan.log_info();
-    Log::info("=======================================================\n");
+        if (!options.trace_file.empty())
+            Trace::enable();
+
+        auto const regressed = run_tenants(options, devices, baseline, score_reference);
+
+        if (!options.trace_file.empty())
+            Trace::write_file(options.trace_file);
+
+        return regressed ? 2 : 0;
+    }
+
+    auto& ws = ws_loader.load_window_system();
 
     if (!options.benchmarks.empty())
         bc.add(options.benchmarks);
@@ -142,17 +503,68 @@ try
     if (!bc.contains_normal_scenes())
         bc.add(DefaultBenchmarks::get());
 
-    MainLoop main_loop{vulkan, ws, bc, options};
+    if (!options.trace_file.empty())
+        Trace::enable();
 
-    set_up_sighandler(main_loop);
+    RunContext const ctx{options, ws_loader, ws, bc, baseline, score_reference};
+    std::vector<DeviceRun> runs;
+    bool regressed = false;
+    bool invalid = false;
 
-    main_loop.run();
+    if (devices.empty())
+    {
+        VulkanState vulkan{ws.vulkan_wsi(), ChooseFirstSupportedStrategy{}, options.show_debug};
+        DeviceRun run{};
+        regressed = run_benchmarks(ctx, vulkan, options.results_file, run);
+        invalid = ImageValidation::has_failures(run.results);
+    }
 
-    Log::info("=======================================================\n");
-    Log::info("                                   vkmark Score: %u\n",
-              main_loop.score());
-    Log::info("=======================================================\n");
+    for (auto const& device : devices)
+    {
+        if (stop_requested)
+            break;
+
+        std::unique_ptr<VulkanState> vulkan;
+
+        try
+        {
+            vulkan = std::make_unique<VulkanState>(
+                ws.vulkan_wsi(), ChooseByIndexStrategy{device.index}, options.show_debug);
+        }
+        catch (std::exception const& e)
+        {
+            if (!options.all_devices)
+                throw;
+            Log::warning("Skipping device %u (%s): %s\n",
+                         device.index, device.name.c_str(), e.what());
+            continue;
+        }
+
+        auto const results_file = options.all_devices && !options.results_file.empty() ?
+            device_results_file(options.results_file, device.index) :
+            options.results_file;
+
+        DeviceRun run{device, {}, 0.0};
+        if (run_benchmarks(ctx, *vulkan, results_file, run))
+            regressed = true;
+        if (ImageValidation::has_failures(run.results))
+            invalid = true;
+        runs.push_back(run);
+    }
+
+    if (runs.size() > 1)
+    {
+        DeviceComparison::log(runs, options.score_method);
+        Log::info("=======================================================\n");
+    }
+
+    if (!options.trace_file.empty())
+        Trace::write_file(options.trace_file);
+
+    if (invalid)
+        return 3;
 
+    return regressed ? 2 : 0;
 }
 catch (std::exception const& e)
 {
@@ -30,6 +30,19 @@
 #include "log.h"
 #include "options.h"
 #include "util.h"
+#include "score.h"
+#include "trace.h"
+#include "energy_sampler.h"
+#include "cpu_counters.h"
+#include "host_memory.h"
+#include "frame_progress.h"
+#include "present_thread.h"
+#include "image_readback.h"
+#include "image_validation.h"
+#include "frame_capture.h"
+#include "frame_writer.h"
+
+#include <cstdio>
 
 namespace
 {
@@ -61,6 +74,324 @@ void log_scene_fps(unsigned int fps)
     Log::flush();
 }
 
+void log_scene_time_to_complete(Scene const& scene)
+{
+    if (!scene.is_fixed_frames())
+        return;
+
+    auto const fmt = Log::continuation_prefix +
+        "    Time to complete %llu frames: %.3f ms\n";
+    Log::info(fmt.c_str(),
+              static_cast<unsigned long long>(scene.num_frames()),
+              scene.elapsed_time() / 1000.0);
+    Log::flush();
+}
+
+void log_scene_frame_time_stats(FrameTimeStats const& stats)
+{
+    if (stats.count() == 0)
+        return;
+
+    auto const fmt = Log::continuation_prefix +
+        "    FrameTime min: %.3f ms median: %.3f ms p90: %.3f ms p99: %.3f ms"
+        " p99.9: %.3f ms max: %.3f ms stddev: %.3f ms\n";
+    Log::info(fmt.c_str(),
+              stats.min() / 1000.0,
+              stats.percentile(50.0) / 1000.0,
+              stats.percentile(90.0) / 1000.0,
+              stats.percentile(99.0) / 1000.0,
+              stats.percentile(99.9) / 1000.0,
+              stats.max() / 1000.0,
+              stats.stddev() / 1000.0);
+    Log::flush();
+}
+
+void log_scene_gpu_time_stats(FrameTimeStats const& gpu_stats,
+                              FrameTimeStats const& frame_stats)
+{
+    if (gpu_stats.count() == 0)
+        return;
+
+    // GPU times are in ns, frame times in us
+    auto const gpu_busy = frame_stats.mean() > 0.0 ?
+        100.0 * gpu_stats.mean() / (1000.0 * frame_stats.mean()) : 0.0;
+
+    auto const fmt = Log::continuation_prefix +
+        "    GPUTime mean: %.3f ms median: %.3f ms p99: %.3f ms max: %.3f ms"
+        " GPUBusy: %.1f%%\n";
+    Log::info(fmt.c_str(),
+              gpu_stats.mean() / 1000000.0,
+              gpu_stats.percentile(50.0) / 1000000.0,
+              gpu_stats.percentile(99.0) / 1000000.0,
+              gpu_stats.max() / 1000000.0,
+              gpu_busy);
+    Log::flush();
+}
+
+void log_scene_pipeline_stats(BenchmarkResult const& result)
+{
+    if (result.pipeline_stats_samples == 0)
+        return;
+
+    auto const fmt = Log::continuation_prefix +
+        "    PipelineStats per frame: IA vertices: %.0f IA primitives: %.0f"
+        " VS invocations: %.0f clipping primitives: %.0f FS invocations: %.0f\n";
+    Log::info(fmt.c_str(),
+              result.input_assembly_vertices,
+              result.input_assembly_primitives,
+              result.vertex_shader_invocations,
+              result.clipping_primitives,
+              result.fragment_shader_invocations);
+
+    auto const rate_fmt = Log::continuation_prefix +
+        "    Throughput: %.4g primitives/s %.4g fragments/s\n";
+    Log::info(rate_fmt.c_str(),
+              result.input_assembly_primitives * result.fps,
+              result.fragment_shader_invocations * result.fps);
+    Log::flush();
+}
+
+void log_scene_setup_time(BenchmarkResult const& result)
+{
+    std::string phases;
+
+    for (auto const& phase : result.setup_phases)
+    {
+        char buf[128];
+        std::snprintf(buf, sizeof(buf), "%s%s: %.3f ms",
+                      phases.empty() ? " (" : ", ",
+                      phase.name.c_str(), phase.duration / 1000.0);
+        phases += buf;
+    }
+
+    if (!phases.empty())
+        phases += ")";
+
+    auto const fmt = Log::continuation_prefix + "    Setup time: %.3f ms%s\n";
+    Log::info(fmt.c_str(), result.setup_time_ms, phases.c_str());
+    Log::flush();
+}
+
+void log_scene_teardown_time(BenchmarkResult const& result)
+{
+    auto const fmt = Log::continuation_prefix + "    Teardown time: %.3f ms\n";
+    Log::info(fmt.c_str(), result.teardown_time_ms);
+    Log::flush();
+}
+
+void log_scene_energy(BenchmarkResult const& result)
+{
+    if (!result.has_energy)
+        return;
+
+    auto const fmt = Log::continuation_prefix +
+        "    Energy: %.3f J (%.3f mJ/frame) Power: %.2f W\n";
+    Log::info(fmt.c_str(),
+              result.energy_j,
+              1000.0 * result.energy_per_frame_j,
+              result.power_w);
+    Log::flush();
+}
+
+void log_scene_cpu_usage(BenchmarkResult const& result)
+{
+    if (!result.has_cpu_usage)
+        return;
+
+    auto const frames = result.frames > 0 ? result.frames : 1;
+
+    auto const fmt = Log::continuation_prefix +
+        "    CPU user: %.1f ms sys: %.1f ms (%.3f ms/frame)"
+        " Context switches voluntary: %llu involuntary: %llu\n";
+    Log::info(fmt.c_str(),
+              result.cpu_user_ms,
+              result.cpu_sys_ms,
+              (result.cpu_user_ms + result.cpu_sys_ms) / frames,
+              static_cast<unsigned long long>(result.voluntary_context_switches),
+              static_cast<unsigned long long>(result.involuntary_context_switches));
+
+    if (result.has_perf_counters)
+    {
+        auto const perf_fmt = Log::continuation_prefix +
+            "    Per frame instructions: %.0f cycles: %.0f cache misses: %.0f IPC: %.2f\n";
+        Log::info(perf_fmt.c_str(),
+                  static_cast<double>(result.instructions) / frames,
+                  static_cast<double>(result.cycles) / frames,
+                  static_cast<double>(result.cache_misses) / frames,
+                  result.cycles > 0 ?
+                      static_cast<double>(result.instructions) / result.cycles : 0.0);
+    }
+
+    Log::flush();
+}
+
+void log_scene_memory_stats(BenchmarkResult const& result)
+{
+    if (!result.has_memory_stats)
+        return;
+
+    auto const mib = [] (uint64_t bytes) { return bytes / (1024.0 * 1024.0); };
+
+    auto const fmt = Log::continuation_prefix +
+        "    Memory device setup: %.1f MiB peak: %.1f MiB host RSS: %.1f MiB peak: %.1f MiB\n";
+    Log::info(fmt.c_str(),
+              mib(result.device_memory_setup_bytes),
+              mib(result.device_memory_peak_bytes),
+              mib(result.host_rss_bytes),
+              mib(result.host_rss_peak_bytes));
+
+    if (result.has_memory_budget)
+    {
+        auto const heap_fmt = Log::continuation_prefix +
+            "    Heap %u usage before setup: %.1f MiB after setup: %.1f MiB budget: %.1f MiB\n";
+
+        for (size_t i = 0; i < result.heaps.size(); ++i)
+        {
+            auto const& heap = result.heaps[i];
+            Log::info(heap_fmt.c_str(),
+                      static_cast<unsigned int>(i),
+                      mib(heap.usage_before_setup),
+                      mib(heap.usage_after_setup),
+                      mib(heap.budget));
+        }
+    }
+
+    Log::flush();
+}
+
+void log_scene_adaptive_info(Scene const& scene)
+{
+    if (!scene.is_adaptive())
+        return;
+
+    auto const& window_stats = scene.window_fps_stats();
+    auto const fmt = Log::continuation_prefix +
+        "    Adaptive windows: %u FPS CV: %.2f%% 95%% CI: +/-%.1f FPS (%s)\n";
+    Log::info(fmt.c_str(),
+              static_cast<unsigned int>(window_stats.count()),
+              100.0 * window_stats.cv(),
+              window_stats.confidence_interval95(),
+              scene.has_converged() ? "stable" : "not stable, reached duration");
+    Log::flush();
+}
+
+void log_scene_frames_in_flight(Scene const& scene, BenchmarkResult const& result)
+{
+    // Only report pipelining when explicitly requested
+    if (result.frames_in_flight == 0 ||
+        scene.options().at("frames-in-flight").value == "0")
+    {
+        return;
+    }
+
+    auto const fmt = Log::continuation_prefix +
+        "    Frames in flight: %u CPU/GPU overlap: %.1f%% Frame slot wait: %.3f ms/frame\n";
+    Log::info(fmt.c_str(),
+              result.frames_in_flight,
+              100.0 * result.cpu_gpu_overlap,
+              result.frame_wait_ms);
+    Log::flush();
+}
+
+void log_scene_frame_progress(Scene const& scene)
+{
+    auto const progress = scene.frame_progress();
+    if (!progress || progress->latency_stats().count() == 0)
+        return;
+
+    auto const fmt = Log::continuation_prefix +
+        "    GPU completion latency: %.3f ms Frames pending on GPU: %.2f\n";
+    Log::info(fmt.c_str(),
+              progress->latency_stats().mean(),
+              progress->pending_stats().mean());
+    Log::flush();
+}
+
+void log_scene_present_thread(PresentThread const* present_thread,
+                              BenchmarkResult const& result)
+{
+    if (!present_thread)
+        return;
+
+    auto const frames = result.frames > 0 ? result.frames : 1;
+
+    auto const fmt = Log::continuation_prefix +
+        "    Present thread: %.3f ms/frame Waiting for images: %.3f ms/frame\n";
+    Log::info(fmt.c_str(),
+              present_thread->present_time() / 1000.0 / frames,
+              present_thread->wait_time() / 1000.0 / frames);
+    Log::flush();
+}
+
+void log_scene_validation(BenchmarkResult const& result,
+                          ImageValidationResult const& validation,
+                          std::string const& path)
+{
+    auto const hash = ImageValidation::hash_string(validation.hash);
+
+    if (validation.reference_written)
+    {
+        auto const fmt = Log::continuation_prefix +
+            "    Validation hash: %s (reference written to %s)\n";
+        Log::info(fmt.c_str(), hash.c_str(), path.c_str());
+    }
+    else if (result.valid)
+    {
+        auto const fmt = Log::continuation_prefix +
+            "    Validation hash: %s matches the reference\n";
+        Log::info(fmt.c_str(), hash.c_str());
+    }
+    else
+    {
+        auto const fmt = Log::continuation_prefix +
+            "    Validation hash: %s MISMATCH: %llu pixels differ from %s"
+            " (max difference: %u)\n";
+        Log::info(fmt.c_str(), hash.c_str(),
+                  static_cast<unsigned long long>(validation.mismatched_pixels),
+                  path.c_str(), validation.max_difference);
+    }
+    Log::flush();
+}
+
+void log_scene_not_validated(uint64_t frames, unsigned int validate_frame)
+{
+    auto const fmt = Log::continuation_prefix +
+        "    Validation skipped: the benchmark ended after %llu of %u frames\n";
+    Log::info(fmt.c_str(), static_cast<unsigned long long>(frames), validate_frame);
+    Log::flush();
+}
+
+// Compares the frame copied by the readback with its reference image
+void validate_frame(ImageReadback& readback, Options const& options,
+                    BenchmarkResult& result)
+{
+    auto const path = options.validate_dir + "/" +
+        ImageValidation::reference_file_name(result.description, options.validate_frame);
+    auto const rgba = readback.rgba();
+    auto const validation = ImageValidation::validate(
+        rgba.data(), readback.extent().width, readback.extent().height,
+        path, options.validate_tolerance);
+
+    result.has_validation = true;
+    result.valid = validation.valid;
+    result.image_hash = ImageValidation::hash_string(validation.hash);
+    result.mismatched_pixels = validation.mismatched_pixels;
+
+    log_scene_validation(result, validation, path);
+}
+
+void log_scene_capture(uint64_t frames, std::string const& dir, double wait_ms)
+{
+    auto const fmt = Log::continuation_prefix +
+        "    Captured %llu frames to %s, waiting %.3f ms/frame for the capture\n";
+    Log::info(fmt.c_str(), static_cast<unsigned long long>(frames), dir.c_str(), wait_ms);
+    Log::flush();
+}
+
+// Captured frames whose copies may be in flight, and frames waiting to be
+// written, before the rendering loop has to wait for them
+uint32_t const capture_buffers = 4;
+size_t const capture_queue_size = 8;
 
 template <typename T>
 void advance_iter(T& iter, T const& start, T const& end, bool run_forever)
@@ -77,12 +408,31 @@ MainLoop::MainLoop(VulkanState& vulkan,
                    BenchmarkCollection& bc,
                    Options const& options)
     : vulkan{vulkan}, ws{ws}, bc{bc}, options{options},
-      should_stop{false},
-      total_fps{0},
-      total_benchmarks{0}
+      should_stop{false}
 {
+    if (options.sample_energy)
+    {
+        energy_sampler = std::make_unique<EnergySampler>(
+            options.sysfs_root, std::chrono::milliseconds{100});
+
+        if (!energy_sampler->has_sources())
+        {
+            Log::warning("No energy counters found in %s/class/{powercap,hwmon},"
+                         " energy sampling is disabled\n",
+                         options.sysfs_root.c_str());
+            energy_sampler.reset();
+        }
+    }
+
+    if (options.cpu_counters)
+        cpu_counters = std::make_unique<CPUCounters>();
+
+    if (!options.capture_frames.empty())
+        frame_writer = std::make_unique<FrameWriter>(options.capture_format, capture_queue_size);
 }
 
+MainLoop::~MainLoop() = default;
+
 void MainLoop::run()
 {
     auto const& benchmarks = bc.benchmarks();
@@ -112,28 +462,232 @@ void MainLoop::run()
 
         log_scene_info(scene, options.show_all_options);
 
-        auto const scene_teardown = Util::on_scope_exit([&] { scene.teardown(); });
+        auto const scene_teardown = Util::on_scope_exit(
+            [&, num_results = results_.size()]
+            {
+                auto const teardown_start = Util::get_timestamp_us();
+                scene.teardown();
+
+                // Only record the teardown of benchmarks that produced a result
+                if (results_.size() > num_results)
+                {
+                    auto& result = results_.back();
+                    result.teardown_time_ms =
+                        (Util::get_timestamp_us() - teardown_start) / 1000.0;
+                    if (options.setup_times)
+                        log_scene_teardown_time(result);
+                }
+            });
+
+        BenchmarkResult setup_memory{};
+        if (options.memory_stats)
+            begin_setup_memory_stats(setup_memory);
+
+        auto const setup_start = Util::get_timestamp_us();
         scene.setup(vulkan, ws.vulkan_images());
+        auto const setup_time = Util::get_timestamp_us() - setup_start;
+
+        if (options.memory_stats)
+            end_setup_memory_stats(setup_memory);
 
         bool should_quit = false;
 
+        bool const use_present_thread = scene.options().at("present").value == "thread";
+        if (use_present_thread && !present_thread)
+            present_thread = std::make_unique<PresentThread>(ws);
+
+        // Once it exists, images are always acquired through the present
+        // thread, as it may hold images acquired in advance
+        auto const next_image = [&]
+            {
+                return present_thread ? present_thread->next_vulkan_image() :
+                                        ws.next_vulkan_image();
+            };
+        auto const present_image = [&] (VulkanImage const& image)
+            {
+                if (present_thread)
+                    present_thread->present_vulkan_image(image);
+                else
+                    ws.present_vulkan_image(image);
+            };
+
+        if (use_present_thread)
+        {
+            present_thread->reset_stats();
+            present_thread->start();
+        }
+
+        // Stops the present thread before teardown if the benchmark failed.
+        // The exception of the benchmark is reported instead of any
+        // exception of the present thread.
+        auto const present_thread_stop = Util::on_scope_exit(
+            [&]
+            {
+                if (present_thread && present_thread->is_running())
+                {
+                    try { present_thread->stop(); }
+                    catch (...) {}
+                }
+            });
+
+        // The frame to validate is copied during the benchmark, but only
+        // compared with the reference afterwards, to not disturb the
+        // measurements more than needed
+        std::unique_ptr<ImageReadback> validation_readback;
+        if (!options.validate_dir.empty())
+        {
+            auto const images = ws.vulkan_images();
+
+            if (!ws.supports_readback())
+            {
+                Log::warning("Can't validate images, the window system doesn't "
+                             "support reading them back\n");
+            }
+            else if (images.empty() || !ImageReadback::is_format_supported(images[0].format))
+            {
+                Log::warning("Can't validate images with format %s\n",
+                             images.empty() ? "<none>" :
+                                              to_string(images[0].format).c_str());
+            }
+            else
+            {
+                validation_readback = std::make_unique<ImageReadback>(
+                    vulkan, images[0].extent, images[0].format);
+            }
+        }
+
+        std::unique_ptr<FrameCapture> frame_capture;
+        std::string capture_stem;
+        if (frame_writer)
+        {
+            auto const images = ws.vulkan_images();
+
+            if (!ws.supports_readback())
+            {
+                Log::warning("Can't capture images, the window system doesn't "
+                             "support reading them back\n");
+            }
+            else if (images.empty() || !ImageReadback::is_format_supported(images[0].format))
+            {
+                Log::warning("Can't capture images with format %s\n",
+                             images.empty() ? "<none>" :
+                                              to_string(images[0].format).c_str());
+            }
+            else
+            {
+                frame_capture = std::make_unique<FrameCapture>(
+                    vulkan, images[0].extent, images[0].format, capture_buffers,
+                    *frame_writer);
+                capture_stem = options.capture_dir + "/" +
+                    Results::file_stem(scene.info_string(false));
+                frame_writer->reset_stats();
+            }
+        }
+
+        uint64_t frames_drawn = 0;
+
         scene.start();
+        start_host_measurements();
 
         while (scene.is_running() &&
                !(should_quit = ws.should_quit()) &&
                !should_stop)
         {
-            ws.present_vulkan_image(
-                scene.draw(ws.next_vulkan_image()));
-            scene.update();
+            bool const was_warming_up = scene.is_warming_up();
+
+            Trace::Scope const frame_trace{"frame"};
+
+            auto const image = Trace::traced(
+                "acquire", [&] { return next_image(); });
+            auto drawn_image = Trace::traced(
+                "draw", [&] { return scene.draw(image); });
+            ++frames_drawn;
+            if (validation_readback && frames_drawn == options.validate_frame)
+            {
+                drawn_image = Trace::traced(
+                    "readback", [&] { return validation_readback->submit(drawn_image); });
+            }
+            if (frame_capture && options.capture_frames.contains(frames_drawn))
+            {
+                drawn_image = Trace::traced(
+                    "capture", [&]
+                    {
+                        return frame_capture->capture(drawn_image, capture_stem, frames_drawn);
+                    });
+            }
+            Trace::traced(
+                "present", [&] { present_image(drawn_image); });
+            Trace::traced("update", [&] { scene.update(); });
+
+            // Like the scene, restart the measurements when warm-up ends
+            if (was_warming_up && !scene.is_warming_up())
+            {
+                start_host_measurements();
+                if (use_present_thread)
+                    present_thread->reset_stats();
+            }
+        }
+
+        if (use_present_thread)
+            present_thread->stop();
+
+        results_.push_back(BenchmarkResult::from_scene(scene));
+        auto& result = results_.back();
+        result.setup_time_ms = setup_time / 1000.0;
+        stop_host_measurements(result);
+
+        if (use_present_thread)
+        {
+            auto const frames = result.frames > 0 ? result.frames : 1;
+            result.metrics.emplace_back(
+                "present_thread_ms", present_thread->present_time() / 1000.0 / frames);
+            result.metrics.emplace_back(
+                "present_wait_ms", present_thread->wait_time() / 1000.0 / frames);
+        }
+
+        double capture_wait_ms = 0.0;
+        if (frame_capture)
+        {
+            auto const frames = result.frames > 0 ? result.frames : 1;
+            // Only the waits while rendering disturb the measurements
+            auto const capture_wait = frame_capture->wait_time() + frame_writer->wait_time();
+            capture_wait_ms = capture_wait / 1000.0 / frames;
+            result.metrics.emplace_back("capture_wait_ms", capture_wait_ms);
+
+            frame_capture->finish();
+            frame_writer->flush();
         }
 
+        if (options.memory_stats)
+            finish_memory_stats(setup_memory, result);
+
         auto const scene_fps = scene.average_fps();
 
         log_scene_fps(scene_fps);
+        log_scene_time_to_complete(scene);
+        log_scene_frame_time_stats(scene.frame_time_stats());
+        log_scene_gpu_time_stats(scene.gpu_time_stats(), scene.frame_time_stats());
+        log_scene_adaptive_info(scene);
+        log_scene_frames_in_flight(scene, result);
+        log_scene_frame_progress(scene);
+        log_scene_present_thread(use_present_thread ? present_thread.get() : nullptr, result);
+        if (options.setup_times)
+            log_scene_setup_time(result);
+        log_scene_pipeline_stats(result);
+        log_scene_energy(result);
+        log_scene_cpu_usage(result);
+        log_scene_memory_stats(result);
 
-        total_fps += scene_fps;
-        ++total_benchmarks;
+        if (frame_capture)
+        {
+            log_scene_capture(frame_capture->frames_captured(), options.capture_dir,
+                              capture_wait_ms);
+        }
+
+        if (validation_readback && frames_drawn >= options.validate_frame)
+            validate_frame(*validation_readback, options, result);
+        else if (validation_readback)
+            log_scene_not_validated(frames_drawn, options.validate_frame);
 
         if (should_quit || should_stop)
             break;
@@ -144,12 +698,113 @@ void MainLoop::run()
     }
 }
 
+void MainLoop::start_host_measurements()
+{
+    if (energy_sampler)
+        energy_sampler->start();
+    if (cpu_counters)
+        cpu_counters->start();
+}
+
+void MainLoop::stop_host_measurements(BenchmarkResult& result)
+{
+    if (cpu_counters)
+    {
+        auto const usage = cpu_counters->stop();
+
+        result.has_cpu_usage = true;
+        result.cpu_user_ms = usage.user_ms;
+        result.cpu_sys_ms = usage.sys_ms;
+        result.voluntary_context_switches = usage.voluntary_context_switches;
+        result.involuntary_context_switches = usage.involuntary_context_switches;
+        result.has_perf_counters = usage.has_perf_counters;
+        result.instructions = usage.instructions;
+        result.cycles = usage.cycles;
+        result.cache_misses = usage.cache_misses;
+    }
+
+    if (energy_sampler)
+    {
+        auto const energy = energy_sampler->stop();
+
+        if (energy.seconds > 0.0)
+        {
+            result.has_energy = true;
+            result.energy_j = energy.joules;
+            result.energy_per_frame_j =
+                result.frames > 0 ? energy.joules / result.frames : 0.0;
+            result.power_w = energy.joules / energy.seconds;
+        }
+    }
+}
+
+void MainLoop::begin_setup_memory_stats(BenchmarkResult& stats)
+{
+    auto const budget = vulkan.memory_budget();
+
+    stats.has_memory_budget = !budget.empty();
+    stats.heaps.resize(vulkan.memory_tracker().num_heaps());
+    for (size_t i = 0; i < budget.size() && i < stats.heaps.size(); ++i)
+        stats.heaps[i].usage_before_setup = budget[i].usage;
+
+    vulkan.memory_tracker().reset_peak();
+    HostMemory::reset_peak_rss();
+}
+
+void MainLoop::end_setup_memory_stats(BenchmarkResult& stats)
+{
+    auto const budget = vulkan.memory_budget();
+    auto& tracker = vulkan.memory_tracker();
+
+    stats.device_memory_setup_bytes = tracker.current_bytes();
+
+    for (size_t i = 0; i < stats.heaps.size(); ++i)
+    {
+        stats.heaps[i].allocated_bytes = tracker.heap_bytes(i);
+        if (i < budget.size())
+        {
+            stats.heaps[i].usage_after_setup = budget[i].usage;
+            stats.heaps[i].budget = budget[i].budget;
+        }
+    }
+
+    for (uint32_t i = 0; i < tracker.num_types(); ++i)
+    {
+        if (tracker.type_bytes(i) > 0)
+        {
+            Log::debug("MainLoop: Memory type %u: %llu bytes allocated in setup\n",
+                       i, static_cast<unsigned long long>(tracker.type_bytes(i)));
+        }
+    }
+}
+
+void MainLoop::finish_memory_stats(BenchmarkResult const& setup_stats, BenchmarkResult& result)
+{
+    result.has_memory_stats = true;
+    result.device_memory_setup_bytes = setup_stats.device_memory_setup_bytes;
+    result.device_memory_peak_bytes = vulkan.memory_tracker().peak_bytes();
+    result.host_rss_bytes = HostMemory::current_rss();
+    result.host_rss_peak_bytes = HostMemory::peak_rss();
+    result.has_memory_budget = setup_stats.has_memory_budget;
+    result.heaps = setup_stats.heaps;
+}
+
 void MainLoop::stop()
 {
     should_stop = true;
 }
 
-unsigned int MainLoop::score()
+void MainLoop::set_score_reference(std::vector<BenchmarkResult> const& reference)
+{
+    score_reference = reference;
+}
+
+double MainLoop::score()
+{
+    return Score::calculate(options.score_method, results_, score_reference);
+}
+
+std::vector<BenchmarkResult> const& MainLoop::results() const
 {
-    return total_benchmarks == 0 ? 0 : (total_fps / total_benchmarks);
+    return results_;
 }
@@ -22,11 +22,19 @@
 
 #pragma once
 
+#include "results.h"
+
 #include <atomic>
+#include <memory>
+#include <vector>
 
 class VulkanState;
 class WindowSystem;
 class BenchmarkCollection;
+class EnergySampler;
+class CPUCounters;
+class PresentThread;
+class FrameWriter;
 struct Options;
 
 class MainLoop
@@ -37,19 +45,33 @@ public:
         WindowSystem& ws,
         BenchmarkCollection& bc,
         Options const& options);
+    ~MainLoop();
 
     void run();
     void stop();
 
-    unsigned int score();
+    void set_score_reference(std::vector<BenchmarkResult> const& reference);
+
+    double score();
+    std::vector<BenchmarkResult> const& results() const;
 
 private:
+    void start_host_measurements();
+    void stop_host_measurements(BenchmarkResult& result);
+    void begin_setup_memory_stats(BenchmarkResult& stats);
+    void end_setup_memory_stats(BenchmarkResult& stats);
+    void finish_memory_stats(BenchmarkResult const& setup_stats, BenchmarkResult& result);
+
     VulkanState& vulkan;
     WindowSystem& ws;
     BenchmarkCollection& bc;
     Options const& options;
 
     std::atomic<bool> should_stop;
-    unsigned int total_fps;
-    unsigned int total_benchmarks;
+    std::vector<BenchmarkResult> results_;
+    std::vector<BenchmarkResult> score_reference;
+    std::unique_ptr<EnergySampler> energy_sampler;
+    std::unique_ptr<CPUCounters> cpu_counters;
+    std::unique_ptr<PresentThread> present_thread;
+    std::unique_ptr<FrameWriter> frame_writer;
 };
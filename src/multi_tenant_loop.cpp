@@ -0,0 +1,150 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "multi_tenant_loop.h"
+#include "benchmark.h"
+#include "benchmark_collection.h"
+#include "log.h"
+#include "options.h"
+#include "scene.h"
+#include "score.h"
+#include "tenant_fairness.h"
+#include "trace.h"
+#include "util.h"
+#include "vulkan_image.h"
+#include "window_system.h"
+
+MultiTenantLoop::MultiTenantLoop(std::vector<Tenant> const& tenants,
+                                 Options const& options)
+    : tenants{tenants}, options{options}, pool{tenants.size()},
+      should_stop{false}
+{
+}
+
+void MultiTenantLoop::run()
+{
+    std::vector<std::vector<Benchmark*>> benchmarks;
+    for (auto const& tenant : tenants)
+        benchmarks.push_back(tenant.bc.benchmarks());
+
+    for (size_t b = 0; b < benchmarks[0].size() && !should_stop; ++b)
+    try
+    {
+        std::vector<Scene*> scenes;
+        for (size_t t = 0; t < tenants.size(); ++t)
+            scenes.push_back(&benchmarks[t][b]->prepare_scene());
+
+        auto& scene = *scenes[0];
+
+        if (!scene.is_valid())
+        {
+            Log::warning("Skipping benchmark with invalid scene name '%s'\n",
+                         scene.name().c_str());
+            continue;
+        }
+
+        // Scenes with empty names are option-setting scenes.
+        // Just set them up and continue.
+        if (scene.name().empty())
+        {
+            for (size_t t = 0; t < tenants.size(); ++t)
+                scenes[t]->setup(tenants[t].vulkan, tenants[t].ws.vulkan_images());
+            continue;
+        }
+
+        Log::info("%s", scene.info_string(options.show_all_options).c_str());
+        Log::flush();
+
+        auto const scenes_teardown = Util::on_scope_exit(
+            [&] { pool.run([&] (size_t t) { scenes[t]->teardown(); }); });
+
+        pool.run(
+            [&] (size_t t)
+            {
+                scenes[t]->setup(tenants[t].vulkan, tenants[t].ws.vulkan_images());
+            });
+
+        std::atomic<bool> done{false};
+
+        pool.run(
+            [&] (size_t t)
+            {
+                auto& tenant_scene = *scenes[t];
+                auto& ws = tenants[t].ws;
+
+                // Stop the other tenants when this one finishes, also on
+                // exceptions, so that all measurements cover the period in
+                // which the GPU was shared
+                auto const stop_others = Util::on_scope_exit([&] { done = true; });
+
+                tenant_scene.start();
+
+                while (tenant_scene.is_running() && !done && !should_stop)
+                {
+                    Trace::Scope const frame_trace{"frame"};
+
+                    auto const image = ws.next_vulkan_image();
+                    ws.present_vulkan_image(tenant_scene.draw(image));
+                    tenant_scene.update();
+                }
+            });
+
+        std::vector<unsigned int> fps;
+        for (auto const s : scenes)
+            fps.push_back(s->average_fps());
+
+        auto const fairness = TenantFairness::compute(fps);
+
+        for (size_t t = 0; t < tenants.size(); ++t)
+        {
+            results_.push_back(BenchmarkResult::from_scene(*scenes[t]));
+            results_.back().metrics.emplace_back("tenant", t);
+            results_.back().metrics.emplace_back("tenant_fairness", fairness.fairness);
+        }
+
+        TenantFairness::log(fps, fairness);
+    }
+    catch (std::exception const& e)
+    {
+        auto const fmt = Log::continuation_prefix + " Failed with exception: %s\n";
+        Log::info(fmt.c_str(), e.what());
+        Log::flush();
+    }
+}
+
+void MultiTenantLoop::stop()
+{
+    should_stop = true;
+}
+
+void MultiTenantLoop::set_score_reference(std::vector<BenchmarkResult> const& reference)
+{
+    score_reference = reference;
+}
+
+double MultiTenantLoop::score()
+{
+    return Score::calculate(options.score_method, results_, score_reference);
+}
+
+std::vector<BenchmarkResult> const& MultiTenantLoop::results() const
+{
+    return results_;
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "results.h"
+#include "worker_pool.h"
+
+#include <atomic>
+#include <vector>
+
+class VulkanState;
+class WindowSystem;
+class BenchmarkCollection;
+struct Options;
+
+// Runs the same benchmarks on several tenants concurrently, each on its own
+// thread, to measure how the throughput is shared when multiple clients
+// use the GPU at the same time. Each tenant has its own Vulkan state,
+// window system and scenes. All tenants set up, run and tear down each
+// benchmark together, and the measurement of a benchmark ends for all
+// tenants when the first one finishes.
+class MultiTenantLoop
+{
+public:
+    struct Tenant
+    {
+        VulkanState& vulkan;
+        WindowSystem& ws;
+        BenchmarkCollection& bc;
+    };
+
+    MultiTenantLoop(std::vector<Tenant> const& tenants, Options const& options);
+
+    void run();
+    void stop();
+
+    void set_score_reference(std::vector<BenchmarkResult> const& reference);
+
+    double score();
+    // The results of all tenants, in tenant order for each benchmark. Each
+    // result has tenant and tenant_fairness metrics.
+    std::vector<BenchmarkResult> const& results() const;
+
+private:
+    std::vector<Tenant> const tenants;
+    Options const& options;
+    WorkerPool pool;
+
+    std::atomic<bool> should_stop;
+    std::vector<BenchmarkResult> results_;
+    std::vector<BenchmarkResult> score_reference;
+};
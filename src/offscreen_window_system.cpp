@@ -0,0 +1,168 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "offscreen_window_system.h"
+
+#include "vulkan_image.h"
+#include "vulkan_state.h"
+#include "vkutil/vkutil.h"
+
+#include <algorithm>
+
+OffscreenWindowSystem::OffscreenWindowSystem(
+    vk::Extent2D extent, vk::Format format, uint32_t num_images)
+    : vk_extent{extent},
+      vk_image_format{format},
+      num_images{num_images},
+      vulkan{nullptr},
+      current_image{0}
+{
+}
+
+VulkanWSI& OffscreenWindowSystem::vulkan_wsi()
+{
+    return *this;
+}
+
+void OffscreenWindowSystem::init_vulkan(VulkanState& vulkan_)
+{
+    vulkan = &vulkan_;
+    current_image = 0;
+    create_vk_images();
+    create_vk_submit_fences();
+    drawn_images.assign(vk_images.size(), VulkanImage{});
+}
+
+void OffscreenWindowSystem::deinit_vulkan()
+{
+    vulkan->device().waitIdle();
+    drawn_images.clear();
+    vk_submit_fences.clear();
+    vk_images.clear();
+}
+
+VulkanImage OffscreenWindowSystem::next_vulkan_image()
+{
+    auto const index = current_image;
+    current_image = (current_image + 1) % vk_images.size();
+
+    wait_for_image(index);
+
+    return {index, vk_images[index], vk_image_format, vk_extent, nullptr,
+            vk_submit_fences[index]};
+}
+
+void OffscreenWindowSystem::present_vulkan_image(VulkanImage const& vulkan_image)
+{
+    // Nothing is displayed, just remember what to wait for before reuse
+    drawn_images[vulkan_image.index] = vulkan_image;
+}
+
+std::vector<VulkanImage> OffscreenWindowSystem::vulkan_images()
+{
+    std::vector<VulkanImage> vulkan_images;
+
+    for (uint32_t i = 0; i < vk_images.size(); ++i)
+        vulkan_images.push_back({i, vk_images[i], vk_image_format, vk_extent, nullptr, nullptr});
+
+    return vulkan_images;
+}
+
+uint32_t OffscreenWindowSystem::max_acquired_images()
+{
+    // Acquiring all images would hand out the first one again
+    return std::max(num_images, 2u) - 1;
+}
+
+bool OffscreenWindowSystem::supports_readback()
+{
+    return true;
+}
+
+bool OffscreenWindowSystem::should_quit()
+{
+    return false;
+}
+
+VulkanWSI::Extensions OffscreenWindowSystem::required_extensions()
+{
+    return {};
+}
+
+bool OffscreenWindowSystem::is_physical_device_supported(vk::PhysicalDevice const&)
+{
+    return true;
+}
+
+std::vector<uint32_t> OffscreenWindowSystem::physical_device_queue_family_indices(
+    vk::PhysicalDevice const&)
+{
+    return {};
+}
+
+void OffscreenWindowSystem::wait_for_image(uint32_t index)
+{
+    // Wait without a timeout: the image is reused right after this, so it
+    // must not be in use anymore, however slow the device is
+    auto& drawn = drawn_images[index];
+
+    if (drawn.timeline_semaphore)
+    {
+        // The submission signaled the timeline instead of the submit fence
+        (void)vulkan->wait_timeline_semaphore(drawn.timeline_semaphore,
+                                              drawn.timeline_value,
+                                              UINT64_MAX);
+    }
+    else if (drawn.submit_fence)
+    {
+        (void)vulkan->device().waitForFences(drawn.submit_fence, true, UINT64_MAX);
+        vulkan->device().resetFences(drawn.submit_fence);
+    }
+
+    drawn = VulkanImage{};
+}
+
+void OffscreenWindowSystem::create_vk_submit_fences()
+{
+    for (uint32_t i = 0; i < vk_images.size(); ++i)
+    {
+        vk_submit_fences.push_back(ManagedResource<vk::Fence>{
+            vulkan->device().createFence(vk::FenceCreateInfo{}),
+            [vptr=vulkan] (auto const& f) { vptr->device().destroyFence(f); }});
+    }
+}
+
+void OffscreenWindowSystem::create_vk_images()
+{
+    for (uint32_t i = 0; i < num_images; ++i)
+    {
+        vk_images.push_back(
+            vkutil::ImageBuilder{*vulkan}
+                .set_extent(vk_extent)
+                .set_format(vk_image_format)
+                .set_tiling(vk::ImageTiling::eOptimal)
+                .set_usage(vk::ImageUsageFlagBits::eColorAttachment |
+                           vk::ImageUsageFlagBits::eTransferSrc |
+                           vk::ImageUsageFlagBits::eTransferDst)
+                .set_memory_properties(vk::MemoryPropertyFlagBits::eDeviceLocal)
+                .set_initial_layout(vk::ImageLayout::eUndefined)
+                .build());
+    }
+}
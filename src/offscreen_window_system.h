@@ -0,0 +1,71 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "window_system.h"
+#include "vulkan_wsi.h"
+#include "managed_resource.h"
+
+#include <vulkan/vulkan.hpp>
+
+// A window system that renders to a ring of device local images that are
+// never displayed, for running benchmarks without a display or a window.
+// It doesn't need any WSI extension. Before an image is handed out again,
+// the rendering of its previous frame is waited for.
+class OffscreenWindowSystem : public WindowSystem, public VulkanWSI
+{
+public:
+    OffscreenWindowSystem(vk::Extent2D extent, vk::Format format, uint32_t num_images);
+
+    VulkanWSI& vulkan_wsi() override;
+    void init_vulkan(VulkanState& vulkan) override;
+    void deinit_vulkan() override;
+
+    VulkanImage next_vulkan_image() override;
+    void present_vulkan_image(VulkanImage const&) override;
+    std::vector<VulkanImage> vulkan_images() override;
+    uint32_t max_acquired_images() override;
+    bool supports_readback() override;
+
+    bool should_quit() override;
+
+    // VulkanWSI
+    Extensions required_extensions() override;
+    bool is_physical_device_supported(vk::PhysicalDevice const& pd) override;
+    std::vector<uint32_t> physical_device_queue_family_indices(
+        vk::PhysicalDevice const& pd) override;
+
+private:
+    void create_vk_images();
+    void create_vk_submit_fences();
+    void wait_for_image(uint32_t index);
+
+    vk::Extent2D const vk_extent;
+    vk::Format const vk_image_format;
+    uint32_t const num_images;
+
+    VulkanState* vulkan;
+    std::vector<ManagedResource<vk::Image>> vk_images;
+    std::vector<ManagedResource<vk::Fence>> vk_submit_fences;
+    // The last drawn image for each index, to wait for before reuse
+    std::vector<VulkanImage> drawn_images;
+    uint32_t current_image;
+};
@@ -26,6 +26,7 @@
 #include <algorithm>
 #include <cctype>
 #include <string>
+#include <stdexcept>
 #include <utility>
 
 #include "options.h"
@@ -40,6 +41,8 @@ struct option long_options[] = {
     {"benchmark", 1, 0, 0},
     {"size", 1, 0, 0},
     {"use-device", 1, 0, 0},
+    {"all-devices", 0, 0, 0},
+    {"tenants", 1, 0, 0},
     {"fullscreen", 0, 0, 0},
     {"present-mode", 1, 0, 0},
     {"pixel-format", 1, 0, 0},
@@ -51,11 +54,46 @@ struct option long_options[] = {
     {"winsys-options", 1, 0, 0},
     {"list-devices", 0, 0, 0},
     {"run-forever", 0, 0, 0},
+    {"results-file", 1, 0, 0},
+    {"results-format", 1, 0, 0},
+    {"compare-to", 1, 0, 0},
+    {"regression-threshold", 1, 0, 0},
+    {"score-method", 1, 0, 0},
+    {"score-reference", 1, 0, 0},
+    {"trace", 1, 0, 0},
+    {"sample-energy", 0, 0, 0},
+    {"sysfs-root", 1, 0, 0},
+    {"cpu-counters", 0, 0, 0},
+    {"memory-stats", 0, 0, 0},
+    {"setup-times", 0, 0, 0},
+    {"validate", 1, 0, 0},
+    {"validate-frame", 1, 0, 0},
+    {"validate-tolerance", 1, 0, 0},
+    {"capture-frames", 1, 0, 0},
+    {"capture-format", 1, 0, 0},
+    {"capture-dir", 1, 0, 0},
     {"debug", 0, 0, 0},
     {"help", 0, 0, 0},
     {0, 0, 0, 0}
 };
 
+// Device selectors that are UUIDs are also stored as such, for the window
+// systems that pick the device themselves
+std::optional<DeviceUUID> parse_device_uuid(std::string const& str)
+{
+    if (str.size() != 2 * VK_UUID_SIZE)
+        return std::nullopt;
+
+    try
+    {
+        return DeviceUUID{str};
+    }
+    catch (std::invalid_argument const&)
+    {
+        return std::nullopt;
+    }
+}
+
 std::pair<int,int> parse_size(std::string const& str)
 {
     std::pair<int,int> size;
@@ -107,6 +145,77 @@ vk::Format parse_pixel_format(std::string const& str)
 }
 
 
+std::string parse_results_format(std::string const& str)
+{
+    if (str != "json" && str != "csv")
+        throw std::runtime_error{"Invalid results format '" + str + "'"};
+
+    return str;
+}
+
+double parse_regression_threshold(std::string const& str)
+{
+    auto const threshold = Util::from_string<double>(str);
+
+    if (threshold < 0.0)
+        throw std::runtime_error{"Invalid regression threshold '" + str + "'"};
+
+    return threshold;
+}
+
+unsigned int parse_tenants(std::string const& str)
+{
+    auto const tenants = Util::from_string<unsigned int>(str);
+
+    if (tenants == 0)
+        throw std::runtime_error{"Invalid number of tenants '" + str + "'"};
+
+    return tenants;
+}
+
+unsigned int parse_validate_frame(std::string const& str)
+{
+    auto const frame = Util::from_string<unsigned int>(str);
+
+    if (frame == 0)
+        throw std::runtime_error{"Invalid validation frame '" + str + "'"};
+
+    return frame;
+}
+
+unsigned int parse_validate_tolerance(std::string const& str)
+{
+    auto const tolerance = Util::from_string<int>(str);
+
+    if (tolerance < 0 || tolerance > 255)
+        throw std::runtime_error{"Invalid validation tolerance '" + str + "'"};
+
+    return tolerance;
+}
+
+CaptureFormat parse_capture_format(std::string const& str)
+{
+    for (auto const format : {CaptureFormat::png, CaptureFormat::y4m})
+    {
+        if (str == to_string(format))
+            return format;
+    }
+
+    throw std::runtime_error{"Invalid capture format '" + str + "'"};
+}
+
+ScoreMethod parse_score_method(std::string const& str)
+{
+    for (auto const method : {ScoreMethod::fps, ScoreMethod::geomean,
+                              ScoreMethod::frametime, ScoreMethod::reference})
+    {
+        if (str == to_string(method))
+            return method;
+    }
+
+    throw std::runtime_error{"Invalid score method '" + str + "'"};
+}
+
 std::vector<Options::WindowSystemOption> parse_window_system_options(
     std::string const& options_str)
 {
@@ -140,7 +249,21 @@ Options::Options()
       show_debug{false},
       show_help{false},
       list_devices{false},
-      use_device_with_uuid{}
+      use_device_with_uuid{},
+      all_devices{false},
+      tenants{1},
+      results_format{"json"},
+      regression_threshold{5.0},
+      score_method{ScoreMethod::fps},
+      sample_energy{false},
+      sysfs_root{"/sys"},
+      cpu_counters{false},
+      memory_stats{false},
+      setup_times{false},
+      validate_frame{10},
+      validate_tolerance{2},
+      capture_format{CaptureFormat::png},
+      capture_dir{"."}
 {
     const char* var;
     var = getenv("VKMARK_WINDOW_SYSTEM_DIR");
@@ -171,12 +294,62 @@ std::string Options::help_string()
         "      --winsys-dir DIR        Directory to search in for window system plugins\n"
         "      --data-dir DIR          Directory to search in for scene data files\n"
         "      --winsys WS             Window system plugin to use (default: choose best)\n"
-        "                              [xcb, wayland, kms]\n"
+        "                              [xcb, wayland, kms, null]\n"
         "      --winsys-options OPTS   Window system options as 'opt1=val1(:opt2=val2)*'\n"
         "      --run-forever           Run indefinitely, looping from the last benchmark\n"
         "                              back to the first\n"
+        "      --results-file FILE     Write the benchmark results to FILE\n"
+        "      --results-format FMT    Format of the results file (default: json)\n"
+        "                              [json, csv]\n"
+        "      --compare-to FILE       Compare the results with a baseline json results\n"
+        "                              file and exit with status 2 on regressions or\n"
+        "                              benchmarks missing from the baseline\n"
+        "      --regression-threshold PCT\n"
+        "                              FPS drop that counts as a regression\n"
+        "                              (default: 5.0)\n"
+        "      --score-method M        How benchmark results are combined into the score\n"
+        "                              (default: fps)\n"
+        "                              [fps, geomean, frametime, reference]\n"
+        "      --score-reference FILE  Json results file to normalize against when using\n"
+        "                              the reference score method\n"
+        "      --trace FILE            Write a trace of per-frame CPU events to FILE\n"
+        "                              in the Chrome JSON trace format\n"
+        "      --sample-energy         Measure host energy usage during each benchmark\n"
+        "                              using sysfs RAPL and hwmon counters\n"
+        "      --sysfs-root DIR        Root of the sysfs tree used for energy sampling\n"
+        "                              (default: /sys)\n"
+        "      --cpu-counters          Measure the CPU time, context switches and, where\n"
+        "                              permitted, hardware counters of each benchmark\n"
+        "      --memory-stats          Report the device memory and host RSS usage of\n"
+        "                              each benchmark\n"
+        "      --setup-times           Report the duration of the startup phases and\n"
+        "                              of the setup and teardown of each benchmark\n"
+        "      --validate DIR          Compare a frame of each benchmark with the\n"
+        "                              reference images in DIR, using a fixed animation\n"
+        "                              time, and exit with status 3 on mismatches\n"
+        "                              (missing reference images are written to DIR)\n"
+        "      --validate-frame N      Frame of each benchmark to validate (default: 10)\n"
+        "      --validate-tolerance T  Largest per-channel difference from the reference\n"
+        "                              images that is not a mismatch (default: 2)\n"
+        "      --capture-frames LIST   Write frames of each benchmark to files, without\n"
+        "                              stalling the rendering: 'all' or a comma\n"
+        "                              separated list of frames and ranges (e.g. 1,10-20)\n"
+        "      --capture-format FMT    Format of the captured frames (default: png)\n"
+        "                              [png, y4m]\n"
+        "      --capture-dir DIR       Directory to write captured frames to\n"
+        "                              (default: current directory)\n"
         "  -d, --debug                 Display debug messages\n"
-        "  -D  --use-device            Use Vulkan device with specified UUID\n"
+        "  -D  --use-device DEV        Use the first Vulkan device matching DEV: a UUID,\n"
+        "                              an index (as listed by --list-devices), a type\n"
+        "                              [discrete, integrated, virtual, cpu] or a part\n"
+        "                              of the device name\n"
+        "      --all-devices           Run the benchmarks on all supported Vulkan devices\n"
+        "                              (or on all devices matching --use-device) and\n"
+        "                              compare the results\n"
+        "      --tenants N             Run N instances of each benchmark concurrently,\n"
+        "                              each on its own thread and logical device,\n"
+        "                              rendering offscreen, and report the fairness\n"
+        "                              of the FPS among them (default: 1)\n"
         "  -L  --list-devices          List Vulkan devices\n"
         "  -h, --help                  Display help\n";
 
@@ -231,6 +404,42 @@ bool Options::parse_args(int argc, char **argv)
             window_system_options = parse_window_system_options(optarg);
         else if (optname == "run-forever")
             run_forever = true;
+        else if (optname == "results-file")
+            results_file = optarg;
+        else if (optname == "results-format")
+            results_format = parse_results_format(optarg);
+        else if (optname == "compare-to")
+            compare_to = optarg;
+        else if (optname == "regression-threshold")
+            regression_threshold = parse_regression_threshold(optarg);
+        else if (optname == "score-method")
+            score_method = parse_score_method(optarg);
+        else if (optname == "score-reference")
+            score_reference = optarg;
+        else if (optname == "trace")
+            trace_file = optarg;
+        else if (optname == "sample-energy")
+            sample_energy = true;
+        else if (optname == "sysfs-root")
+            sysfs_root = optarg;
+        else if (optname == "cpu-counters")
+            cpu_counters = true;
+        else if (optname == "memory-stats")
+            memory_stats = true;
+        else if (optname == "setup-times")
+            setup_times = true;
+        else if (optname == "validate")
+            validate_dir = optarg;
+        else if (optname == "validate-frame")
+            validate_frame = parse_validate_frame(optarg);
+        else if (optname == "validate-tolerance")
+            validate_tolerance = parse_validate_tolerance(optarg);
+        else if (optname == "capture-frames")
+            capture_frames = FrameSelection{optarg};
+        else if (optname == "capture-format")
+            capture_format = parse_capture_format(optarg);
+        else if (optname == "capture-dir")
+            capture_dir = optarg;
         else if (c == 'd' || optname == "debug")
             show_debug = true;
         else if (c == 'h' || optname == "help")
@@ -238,7 +447,14 @@ bool Options::parse_args(int argc, char **argv)
         else if (c == 'L' || optname == "list-devices")
             list_devices = true;
         else if (c == 'D' || optname == "use-device")
-            use_device_with_uuid = {DeviceUUID{std::string{optarg}}};
+        {
+            use_device = optarg;
+            use_device_with_uuid = parse_device_uuid(optarg);
+        }
+        else if (optname == "all-devices")
+            all_devices = true;
+        else if (optname == "tenants")
+            tenants = parse_tenants(optarg);
     }
 
     return true;
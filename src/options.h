@@ -30,6 +30,9 @@
 #include <vulkan/vulkan.hpp>
 
 #include "device_uuid.h"
+#include "frame_selection.h"
+#include "frame_writer.h"
+#include "score.h"
 
 struct Options
 {
@@ -60,6 +63,31 @@ struct Options
     bool show_help;
     bool list_devices;
     std::optional<DeviceUUID> use_device_with_uuid;
+    // Device selector, see DeviceSelector
+    std::string use_device;
+    bool all_devices;
+    // Number of concurrent benchmark instances, see MultiTenantLoop
+    unsigned int tenants;
+    std::string results_file;
+    std::string results_format;
+    std::string compare_to;
+    double regression_threshold;
+    ScoreMethod score_method;
+    std::string score_reference;
+    std::string trace_file;
+    bool sample_energy;
+    std::string sysfs_root;
+    bool cpu_counters;
+    bool memory_stats;
+    bool setup_times;
+    // Directory of the reference images, see ImageValidation
+    std::string validate_dir;
+    unsigned int validate_frame;
+    unsigned int validate_tolerance;
+    // Frames to capture, see FrameCapture
+    FrameSelection capture_frames;
+    CaptureFormat capture_format;
+    std::string capture_dir;
 
 private:
     std::vector<std::string> window_system_help;
@@ -0,0 +1,41 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+struct PipelineStatistics
+{
+    uint64_t input_assembly_vertices;
+    uint64_t input_assembly_primitives;
+    uint64_t vertex_shader_invocations;
+    uint64_t clipping_primitives;
+    uint64_t fragment_shader_invocations;
+
+    PipelineStatistics& operator+=(PipelineStatistics const& other)
+    {
+        input_assembly_vertices += other.input_assembly_vertices;
+        input_assembly_primitives += other.input_assembly_primitives;
+        vertex_shader_invocations += other.vertex_shader_invocations;
+        clipping_primitives += other.clipping_primitives;
+        fragment_shader_invocations += other.fragment_shader_invocations;
+        return *this;
+    }
+};
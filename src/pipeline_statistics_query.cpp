@@ -0,0 +1,96 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "pipeline_statistics_query.h"
+
+#include "vulkan_state.h"
+
+#include <array>
+
+namespace
+{
+
+// Results are returned in the order of the flag bits
+auto const statistics_flags =
+    vk::QueryPipelineStatisticFlagBits::eInputAssemblyVertices |
+    vk::QueryPipelineStatisticFlagBits::eInputAssemblyPrimitives |
+    vk::QueryPipelineStatisticFlagBits::eVertexShaderInvocations |
+    vk::QueryPipelineStatisticFlagBits::eClippingPrimitives |
+    vk::QueryPipelineStatisticFlagBits::eFragmentShaderInvocations;
+size_t const num_statistics = 5;
+
+}
+
+PipelineStatisticsQuery::PipelineStatisticsQuery(VulkanState& vulkan, uint32_t num_slots)
+    : vulkan{vulkan},
+      slot_submitted(num_slots, false)
+{
+    auto const query_pool_create_info = vk::QueryPoolCreateInfo{}
+        .setQueryType(vk::QueryType::ePipelineStatistics)
+        .setQueryCount(num_slots)
+        .setPipelineStatistics(statistics_flags);
+
+    query_pool = ManagedResource<vk::QueryPool>{
+        vulkan.device().createQueryPool(query_pool_create_info),
+        [vptr=&vulkan] (auto const& qp) { vptr->device().destroyQueryPool(qp); }};
+}
+
+bool PipelineStatisticsQuery::is_supported(VulkanState& vulkan)
+{
+    return vulkan.enabled_features().pipelineStatisticsQuery;
+}
+
+void PipelineStatisticsQuery::begin(vk::CommandBuffer const& command_buffer, uint32_t slot)
+{
+    command_buffer.resetQueryPool(query_pool, slot, 1);
+    command_buffer.beginQuery(query_pool, slot, {});
+}
+
+void PipelineStatisticsQuery::end(vk::CommandBuffer const& command_buffer, uint32_t slot)
+{
+    command_buffer.endQuery(query_pool, slot);
+}
+
+std::optional<PipelineStatistics> PipelineStatisticsQuery::collect(uint32_t slot)
+{
+    std::optional<PipelineStatistics> ret;
+
+    // Queries that have never been submitted are in an undefined state
+    // and must not be read back.
+    if (slot_submitted[slot])
+    {
+        // The statistics are followed by the availability value
+        std::array<uint64_t, num_statistics + 1> results{};
+
+        auto const result = vulkan.device().getQueryPoolResults(
+            query_pool, slot, 1,
+            sizeof(results), results.data(), sizeof(results),
+            vk::QueryResultFlagBits::e64 | vk::QueryResultFlagBits::eWithAvailability);
+
+        if (result == vk::Result::eSuccess && results[num_statistics])
+        {
+            ret = PipelineStatistics{
+                results[0], results[1], results[2], results[3], results[4]};
+        }
+    }
+
+    slot_submitted[slot] = true;
+
+    return ret;
+}
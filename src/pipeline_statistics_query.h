@@ -0,0 +1,56 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "managed_resource.h"
+#include "pipeline_statistics.h"
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+class VulkanState;
+
+// Collects pipeline statistics for command buffers using one pipeline
+// statistics query per slot. Results are read back the same way as in
+// GPUTimer, without waiting and delayed by as many frames as there are slots.
+class PipelineStatisticsQuery
+{
+public:
+    PipelineStatisticsQuery(VulkanState& vulkan, uint32_t num_slots);
+
+    static bool is_supported(VulkanState& vulkan);
+
+    // Must be called outside of a render pass
+    void begin(vk::CommandBuffer const& command_buffer, uint32_t slot);
+    void end(vk::CommandBuffer const& command_buffer, uint32_t slot);
+
+    // Returns the statistics of the last submission that used the slot, if
+    // available. Must be called before each submission of a command buffer
+    // that uses the slot.
+    std::optional<PipelineStatistics> collect(uint32_t slot);
+
+private:
+    VulkanState& vulkan;
+    ManagedResource<vk::QueryPool> query_pool;
+    std::vector<bool> slot_submitted;
+};
@@ -0,0 +1,105 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "present_speedup.h"
+#include "log.h"
+
+#include <algorithm>
+
+namespace
+{
+
+std::string option_value(BenchmarkResult const& result, std::string const& name)
+{
+    for (auto const& opt : result.options)
+    {
+        if (opt.first == name)
+            return opt.second;
+    }
+
+    return "";
+}
+
+std::vector<std::pair<std::string, std::string>> options_without_present(
+    BenchmarkResult const& result)
+{
+    auto options = result.options;
+
+    options.erase(
+        std::remove_if(options.begin(), options.end(),
+                       [](auto const& opt) { return opt.first == "present"; }),
+        options.end());
+
+    return options;
+}
+
+}
+
+std::vector<PresentSpeedupEntry> PresentSpeedup::compute(
+    std::vector<BenchmarkResult> const& results)
+{
+    std::vector<PresentSpeedupEntry> entries;
+
+    for (auto const& result : results)
+    {
+        if (option_value(result, "present") != "thread")
+            continue;
+
+        PresentSpeedupEntry entry{result.description, result.fps, false, 0, 0.0};
+        auto const options = options_without_present(result);
+
+        for (auto const& baseline : results)
+        {
+            if (baseline.scene != result.scene ||
+                option_value(baseline, "present") != "inline" ||
+                options_without_present(baseline) != options)
+            {
+                continue;
+            }
+
+            entry.has_baseline = true;
+            entry.inline_fps = baseline.fps;
+            if (baseline.fps > 0)
+                entry.speedup = static_cast<double>(result.fps) / baseline.fps;
+            break;
+        }
+
+        entries.push_back(entry);
+    }
+
+    return entries;
+}
+
+void PresentSpeedup::log(std::vector<PresentSpeedupEntry> const& entries)
+{
+    Log::info("    Present thread speedup (over present=inline)\n");
+
+    for (auto const& e : entries)
+    {
+        if (!e.has_baseline)
+        {
+            Log::info("%s: FPS: %u Inline: <none>\n", e.description.c_str(), e.fps);
+            continue;
+        }
+
+        Log::info("%s: FPS: %u Inline: %u Speedup: %.2fx\n",
+                  e.description.c_str(), e.fps, e.inline_fps, e.speedup);
+    }
+}
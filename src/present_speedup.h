@@ -0,0 +1,49 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "results.h"
+
+#include <string>
+#include <vector>
+
+struct PresentSpeedupEntry
+{
+    std::string description;
+    unsigned int fps;
+    // Only valid if has_baseline is true
+    bool has_baseline;
+    unsigned int inline_fps;
+    double speedup;
+};
+
+namespace PresentSpeedup
+{
+
+// Compares each result of a scene run with present=thread with the result
+// of the same scene run with present=inline and otherwise equal option
+// values. The FPS ratio is the throughput gained by overlapping the
+// presentation of each frame with the CPU work of the next one.
+std::vector<PresentSpeedupEntry> compute(std::vector<BenchmarkResult> const& results);
+
+void log(std::vector<PresentSpeedupEntry> const& entries);
+
+}
@@ -0,0 +1,198 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "present_thread.h"
+#include "window_system.h"
+#include "trace.h"
+#include "util.h"
+
+#include <algorithm>
+
+PresentThread::PresentThread(WindowSystem& ws)
+    : ws{ws},
+      max_acquired{std::max(ws.max_acquired_images(), 1u)},
+      acquired{max_acquired},
+      drawn{max_acquired},
+      num_acquired{0},
+      should_stop{false},
+      failed{false},
+      present_time_{0},
+      wait_time_{0}
+{
+}
+
+PresentThread::~PresentThread()
+{
+    if (thread.joinable())
+    {
+        should_stop = true;
+        notify(drawn_cv);
+        thread.join();
+    }
+}
+
+void PresentThread::start()
+{
+    if (thread.joinable())
+        return;
+
+    should_stop = false;
+    failed = false;
+    error = nullptr;
+    thread = std::thread{[this] { run(); }};
+}
+
+void PresentThread::stop()
+{
+    if (!thread.joinable())
+        return;
+
+    should_stop = true;
+    notify(drawn_cv);
+    thread.join();
+
+    rethrow_error();
+}
+
+bool PresentThread::is_running() const
+{
+    return thread.joinable();
+}
+
+VulkanImage PresentThread::next_vulkan_image()
+{
+    VulkanImage image;
+
+    if (!is_running())
+    {
+        if (!acquired.pop(image))
+        {
+            image = ws.next_vulkan_image();
+            ++num_acquired;
+        }
+        return image;
+    }
+
+    auto const wait_start = Util::get_timestamp_us();
+    Trace::Scope const trace{"wait_image"};
+
+    while (!acquired.pop(image))
+    {
+        if (failed)
+            rethrow_error();
+
+        std::unique_lock<std::mutex> lock{wake_mutex};
+        acquired_cv.wait(lock, [this] { return !acquired.empty() || failed; });
+    }
+
+    wait_time_ += Util::get_timestamp_us() - wait_start;
+
+    return image;
+}
+
+void PresentThread::present_vulkan_image(VulkanImage const& image)
+{
+    if (!is_running())
+    {
+        ws.present_vulkan_image(image);
+        --num_acquired;
+        return;
+    }
+
+    // Never full, as each drawn image was acquired first
+    (void)drawn.push(image);
+    notify(drawn_cv);
+}
+
+uint64_t PresentThread::present_time() const
+{
+    return present_time_;
+}
+
+uint64_t PresentThread::wait_time() const
+{
+    return wait_time_;
+}
+
+void PresentThread::reset_stats()
+{
+    present_time_ = 0;
+    wait_time_ = 0;
+}
+
+void PresentThread::run()
+try
+{
+    while (true)
+    {
+        VulkanImage image;
+
+        if (drawn.pop(image))
+        {
+            auto const start = Util::get_timestamp_us();
+            Trace::traced("present", [&] { ws.present_vulkan_image(image); });
+            present_time_ += Util::get_timestamp_us() - start;
+            --num_acquired;
+        }
+        else if (!should_stop && num_acquired < max_acquired)
+        {
+            auto const start = Util::get_timestamp_us();
+            image = Trace::traced("acquire", [&] { return ws.next_vulkan_image(); });
+            present_time_ += Util::get_timestamp_us() - start;
+            ++num_acquired;
+            (void)acquired.push(image);
+            notify(acquired_cv);
+        }
+        else if (should_stop)
+        {
+            // The last image may have been pushed just before stopping
+            if (drawn.empty())
+                break;
+        }
+        else
+        {
+            std::unique_lock<std::mutex> lock{wake_mutex};
+            drawn_cv.wait(lock, [this] { return !drawn.empty() || should_stop; });
+        }
+    }
+}
+catch (...)
+{
+    error = std::current_exception();
+    failed = true;
+    notify(acquired_cv);
+}
+
+void PresentThread::rethrow_error()
+{
+    if (failed)
+    {
+        failed = false;
+        std::rethrow_exception(error);
+    }
+}
+
+void PresentThread::notify(std::condition_variable& cv)
+{
+    // Taking the mutex ensures that the waiting thread is either already
+    // waiting, or will see the new state when it checks before waiting
+    std::lock_guard<std::mutex> lock{wake_mutex};
+    cv.notify_one();
+}
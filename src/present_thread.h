@@ -0,0 +1,97 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "spsc_queue.h"
+#include "vulkan_image.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+class WindowSystem;
+
+// Runs the image acquisition and presentation of a window system on a
+// dedicated thread, so that blocking waits for the display (e.g. for page
+// flips) overlap with the CPU work of the following frames. Images are
+// passed to and from the rendering thread through lock-free queues, and a
+// thread with nothing to do sleeps until the other one wakes it up.
+//
+// Whenever the window system allows more than one acquired image, the next
+// image is acquired before the previous one is presented, so it is usually
+// ready before the rendering thread asks for it.
+class PresentThread
+{
+public:
+    PresentThread(WindowSystem& ws);
+    ~PresentThread();
+
+    void start();
+    // Waits until all drawn images have been presented and stops the
+    // thread. Images acquired in advance are kept for the next start() or
+    // for next_vulkan_image() calls while the thread is stopped.
+    void stop();
+    bool is_running() const;
+
+    // Called by the rendering thread instead of the window system
+    // methods. If the thread is stopped, next_vulkan_image() returns the
+    // images acquired in advance before acquiring new ones, and
+    // present_vulkan_image() presents directly.
+    VulkanImage next_vulkan_image();
+    void present_vulkan_image(VulkanImage const& image);
+
+    // Total time in microseconds spent acquiring and presenting on the
+    // present thread since the last reset_stats()
+    uint64_t present_time() const;
+    // Total time in microseconds the rendering thread spent waiting for
+    // acquired images since the last reset_stats()
+    uint64_t wait_time() const;
+    void reset_stats();
+
+private:
+    void run();
+    void rethrow_error();
+    // Wakes up the thread waiting on cv, after changing the state it waits for
+    void notify(std::condition_variable& cv);
+
+    WindowSystem& ws;
+    uint32_t const max_acquired;
+    SPSCQueue<VulkanImage> acquired;
+    SPSCQueue<VulkanImage> drawn;
+    // Images acquired and not yet presented, only accessed by the thread
+    // that currently drives the window system
+    uint32_t num_acquired;
+    std::thread thread;
+    std::atomic<bool> should_stop;
+    std::atomic<bool> failed;
+    std::exception_ptr error;
+    // Only used for sleeping, the queues don't need the mutex
+    std::mutex wake_mutex;
+    // Signaled when an image is acquired or the present thread fails
+    std::condition_variable acquired_cv;
+    // Signaled when an image is drawn or the present thread should stop
+    std::condition_variable drawn_cv;
+    std::atomic<uint64_t> present_time_;
+    uint64_t wait_time_;
+};
@@ -0,0 +1,1000 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "results.h"
+
+#include "frame_progress.h"
+#include "scene.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <istream>
+#include <iterator>
+#include <map>
+#include <ostream>
+#include <stdexcept>
+
+namespace
+{
+
+std::string json_string(std::string const& str)
+{
+    std::string ret{"\""};
+
+    for (auto const c : str)
+    {
+        switch (c)
+        {
+            case '"': ret += "\\\""; break;
+            case '\\': ret += "\\\\"; break;
+            case '\n': ret += "\\n"; break;
+            case '\r': ret += "\\r"; break;
+            case '\t': ret += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    char buf[8];
+                    std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+                    ret += buf;
+                }
+                else
+                {
+                    ret += c;
+                }
+                break;
+        }
+    }
+
+    return ret + "\"";
+}
+
+std::string csv_string(std::string const& str)
+{
+    if (str.find_first_of(",\"\n") == std::string::npos)
+        return str;
+
+    std::string ret{"\""};
+
+    for (auto const c : str)
+    {
+        if (c == '"')
+            ret += '"';
+        ret += c;
+    }
+
+    return ret + "\"";
+}
+
+std::string number(double value)
+{
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "%.6g", value);
+    return buf;
+}
+
+std::string hex(uint32_t value)
+{
+    char buf[16];
+    std::snprintf(buf, sizeof(buf), "0x%X", value);
+    return buf;
+}
+
+std::string phases_json(std::vector<SetupTiming::Phase> const& phases)
+{
+    std::string ret{"{"};
+
+    for (size_t i = 0; i < phases.size(); ++i)
+    {
+        ret += (i == 0 ? "" : ", ") + json_string(phases[i].name) + ": " +
+               number(phases[i].duration / 1000.0);
+    }
+
+    return ret + "}";
+}
+
+double phases_total_ms(std::vector<SetupTiming::Phase> const& phases)
+{
+    uint64_t total = 0;
+
+    for (auto const& phase : phases)
+        total += phase.duration;
+
+    return total / 1000.0;
+}
+
+std::string options_string(BenchmarkResult const& result)
+{
+    std::string ret;
+
+    for (auto const& opt : result.options)
+    {
+        if (!ret.empty())
+            ret += ":";
+        ret += opt.first + "=" + opt.second;
+    }
+
+    return ret;
+}
+
+std::string metrics_string(BenchmarkResult const& result)
+{
+    std::string ret;
+
+    for (auto const& metric : result.metrics)
+    {
+        if (!ret.empty())
+            ret += ":";
+        ret += metric.first + "=" + number(metric.second);
+    }
+
+    return ret;
+}
+
+// Minimal JSON reader, sufficient for files produced by write_json()
+struct JsonValue
+{
+    enum class Type { null, boolean, number, string, array, object };
+
+    Type type = Type::null;
+    bool boolean = false;
+    double number = 0.0;
+    std::string string;
+    std::vector<JsonValue> array;
+    std::map<std::string, JsonValue> object;
+
+    JsonValue const* find(std::string const& key) const
+    {
+        auto const iter = object.find(key);
+        return iter != object.end() ? &iter->second : nullptr;
+    }
+
+    double number_or(std::string const& key, double def) const
+    {
+        auto const value = find(key);
+        return value && value->type == Type::number ? value->number : def;
+    }
+};
+
+class JsonParser
+{
+public:
+    JsonParser(std::string const& text) : text{text}, pos{0} {}
+
+    JsonValue parse()
+    {
+        auto value = parse_value();
+        skip_whitespace();
+        if (pos != text.size())
+            error("unexpected trailing characters");
+        return value;
+    }
+
+private:
+    [[noreturn]] void error(std::string const& what)
+    {
+        throw std::runtime_error{
+            "Invalid JSON at offset " + std::to_string(pos) + ": " + what};
+    }
+
+    void skip_whitespace()
+    {
+        while (pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos])))
+            ++pos;
+    }
+
+    char peek()
+    {
+        skip_whitespace();
+        return pos < text.size() ? text[pos] : '\0';
+    }
+
+    void expect(char c)
+    {
+        if (peek() != c)
+            error(std::string{"expected '"} + c + "'");
+        ++pos;
+    }
+
+    bool consume_literal(std::string const& literal)
+    {
+        if (text.compare(pos, literal.size(), literal) != 0)
+            return false;
+        pos += literal.size();
+        return true;
+    }
+
+    JsonValue parse_value()
+    {
+        JsonValue value;
+
+        switch (peek())
+        {
+            case '{': parse_object(value); break;
+            case '[': parse_array(value); break;
+            case '"':
+                value.type = JsonValue::Type::string;
+                value.string = parse_string();
+                break;
+            case 't':
+            case 'f':
+                value.type = JsonValue::Type::boolean;
+                value.boolean = text[pos] == 't';
+                if (!consume_literal(value.boolean ? "true" : "false"))
+                    error("invalid literal");
+                break;
+            case 'n':
+                if (!consume_literal("null"))
+                    error("invalid literal");
+                break;
+            default:
+                value.type = JsonValue::Type::number;
+                value.number = parse_number();
+                break;
+        }
+
+        return value;
+    }
+
+    void parse_object(JsonValue& value)
+    {
+        value.type = JsonValue::Type::object;
+        expect('{');
+
+        if (peek() == '}')
+        {
+            ++pos;
+            return;
+        }
+
+        while (true)
+        {
+            if (peek() != '"')
+                error("expected object key");
+            auto key = parse_string();
+            expect(':');
+            value.object[key] = parse_value();
+
+            if (peek() == ',')
+                ++pos;
+            else
+                break;
+        }
+
+        expect('}');
+    }
+
+    void parse_array(JsonValue& value)
+    {
+        value.type = JsonValue::Type::array;
+        expect('[');
+
+        if (peek() == ']')
+        {
+            ++pos;
+            return;
+        }
+
+        while (true)
+        {
+            value.array.push_back(parse_value());
+
+            if (peek() == ',')
+                ++pos;
+            else
+                break;
+        }
+
+        expect(']');
+    }
+
+    std::string parse_string()
+    {
+        std::string ret;
+
+        expect('"');
+
+        while (pos < text.size() && text[pos] != '"')
+        {
+            char c = text[pos++];
+
+            if (c == '\\')
+            {
+                if (pos >= text.size())
+                    break;
+
+                c = text[pos++];
+                switch (c)
+                {
+                    case 'n': c = '\n'; break;
+                    case 'r': c = '\r'; break;
+                    case 't': c = '\t'; break;
+                    case 'b': c = '\b'; break;
+                    case 'f': c = '\f'; break;
+                    case 'u':
+                        // Only escaped ASCII control characters are expected
+                        if (pos + 4 > text.size())
+                            error("invalid unicode escape");
+                        c = static_cast<char>(
+                            std::strtoul(text.substr(pos, 4).c_str(), nullptr, 16));
+                        pos += 4;
+                        break;
+                    default: break;
+                }
+            }
+
+            ret += c;
+        }
+
+        expect('"');
+
+        return ret;
+    }
+
+    double parse_number()
+    {
+        auto const start = text.c_str() + pos;
+        char* end;
+        auto const ret = std::strtod(start, &end);
+
+        if (end == start)
+            error("invalid value");
+
+        pos += end - start;
+
+        return ret;
+    }
+
+    std::string const& text;
+    size_t pos;
+};
+
+}
+
+BenchmarkResult BenchmarkResult::from_scene(Scene const& scene)
+{
+    BenchmarkResult result{};
+
+    result.scene = scene.name();
+    result.description = scene.info_string(false);
+    if (!result.description.empty() && result.description.back() == ':')
+        result.description.pop_back();
+
+    for (auto const& kv : scene.options())
+        result.options.emplace_back(kv.first, kv.second.value);
+    std::sort(result.options.begin(), result.options.end());
+
+    result.fps = scene.average_fps();
+    result.duration_s = scene.elapsed_time() / 1000000.0;
+    result.frames = scene.num_frames();
+    result.setup_phases = scene.setup_timing().phases();
+
+    result.frames_in_flight = scene.frames_in_flight();
+    if (result.frames_in_flight > 0)
+    {
+        auto const wait_time = scene.frame_wait_time();
+        auto const elapsed_time = scene.elapsed_time();
+        if (result.frames > 0)
+            result.frame_wait_ms = wait_time / 1000.0 / result.frames;
+        if (elapsed_time > 0)
+            result.cpu_gpu_overlap = std::max(0.0, 1.0 - static_cast<double>(wait_time) / elapsed_time);
+    }
+
+    result.metrics = scene.metrics();
+
+    if (scene.is_fixed_frames())
+        result.metrics.emplace_back("time_to_complete_ms", scene.elapsed_time() / 1000.0);
+
+    if (auto const progress = scene.frame_progress())
+    {
+        result.metrics.emplace_back("gpu_completion_latency_ms",
+                                    progress->latency_stats().mean());
+        result.metrics.emplace_back("gpu_frames_pending",
+                                    progress->pending_stats().mean());
+    }
+
+    auto const& ft = scene.frame_time_stats();
+    result.frame_time_mean = ft.mean() / 1000.0;
+    result.frame_time_min = ft.min() / 1000.0;
+    result.frame_time_median = ft.percentile(50.0) / 1000.0;
+    result.frame_time_p90 = ft.percentile(90.0) / 1000.0;
+    result.frame_time_p99 = ft.percentile(99.0) / 1000.0;
+    result.frame_time_p99_9 = ft.percentile(99.9) / 1000.0;
+    result.frame_time_max = ft.max() / 1000.0;
+    result.frame_time_stddev = ft.stddev() / 1000.0;
+
+    auto const& gt = scene.gpu_time_stats();
+    result.gpu_time_samples = gt.count();
+    result.gpu_time_mean = gt.mean() / 1000000.0;
+    result.gpu_time_median = gt.percentile(50.0) / 1000000.0;
+    result.gpu_time_p99 = gt.percentile(99.0) / 1000000.0;
+    result.gpu_time_max = gt.max() / 1000000.0;
+
+    auto const samples = scene.pipeline_stats_samples();
+    if (samples > 0)
+    {
+        auto const& ps = scene.pipeline_stats_total();
+        result.pipeline_stats_samples = samples;
+        result.input_assembly_vertices =
+            static_cast<double>(ps.input_assembly_vertices) / samples;
+        result.input_assembly_primitives =
+            static_cast<double>(ps.input_assembly_primitives) / samples;
+        result.vertex_shader_invocations =
+            static_cast<double>(ps.vertex_shader_invocations) / samples;
+        result.clipping_primitives =
+            static_cast<double>(ps.clipping_primitives) / samples;
+        result.fragment_shader_invocations =
+            static_cast<double>(ps.fragment_shader_invocations) / samples;
+    }
+
+    return result;
+}
+
+std::string Results::file_stem(std::string const& description)
+{
+    static std::string const default_suffix{" <default>"};
+
+    auto str = description;
+    if (!str.empty() && str.back() == ':')
+        str.pop_back();
+    if (str.size() >= default_suffix.size() &&
+        str.compare(str.size() - default_suffix.size(), std::string::npos, default_suffix) == 0)
+    {
+        str.erase(str.size() - default_suffix.size());
+    }
+
+    // Keep characters that are safe in file names, replacing runs of other
+    // characters (e.g. brackets, spaces, slashes) with a single '_'
+    std::string stem;
+    for (auto const c : str)
+    {
+        if (std::isalnum(static_cast<unsigned char>(c)) ||
+            c == '=' || c == '.' || c == ',' || c == '-')
+        {
+            stem += c;
+        }
+        else if (!stem.empty() && stem.back() != '_')
+        {
+            stem += '_';
+        }
+    }
+
+    if (!stem.empty() && stem.back() == '_')
+        stem.pop_back();
+
+    return stem;
+}
+
+bool Results::same_benchmark(BenchmarkResult const& a, BenchmarkResult const& b)
+{
+    if (a.scene != b.scene)
+        return false;
+
+    return std::all_of(
+        a.options.begin(), a.options.end(),
+        [&b](auto const& opt)
+        {
+            auto const iter = std::find_if(
+                b.options.begin(), b.options.end(),
+                [&opt](auto const& other) { return other.first == opt.first; });
+            return iter == b.options.end() || iter->second == opt.second;
+        });
+}
+
+void Results::write_json(std::ostream& os,
+                         RunInfo const& run_info,
+                         std::vector<BenchmarkResult> const& results,
+                         double score)
+{
+    os << "{\n";
+    os << "  \"vkmark_version\": " << json_string(run_info.vkmark_version) << ",\n";
+    os << "  \"window_system\": " << json_string(run_info.window_system) << ",\n";
+    os << "  \"present_mode\": " << json_string(run_info.present_mode) << ",\n";
+    os << "  \"device\": {\n";
+    os << "    \"vendor_id\": " << json_string(hex(run_info.vendor_id)) << ",\n";
+    os << "    \"device_id\": " << json_string(hex(run_info.device_id)) << ",\n";
+    os << "    \"device_name\": " << json_string(run_info.device_name) << ",\n";
+    os << "    \"driver_version\": " << run_info.driver_version << ",\n";
+    os << "    \"device_uuid\": " << json_string(run_info.device_uuid) << "\n";
+    os << "  },\n";
+    os << "  \"startup_time_ms\": " << number(phases_total_ms(run_info.startup_phases)) << ",\n";
+    os << "  \"startup_phases_ms\": " << phases_json(run_info.startup_phases) << ",\n";
+    os << "  \"benchmarks\": [";
+
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        auto const& r = results[i];
+
+        os << (i == 0 ? "\n" : ",\n");
+        os << "    {\n";
+        os << "      \"scene\": " << json_string(r.scene) << ",\n";
+        os << "      \"options\": {";
+        for (size_t j = 0; j < r.options.size(); ++j)
+        {
+            os << (j == 0 ? "" : ", ")
+               << json_string(r.options[j].first) << ": "
+               << json_string(r.options[j].second);
+        }
+        os << "},\n";
+        os << "      \"fps\": " << r.fps << ",\n";
+        os << "      \"duration_s\": " << number(r.duration_s) << ",\n";
+        os << "      \"frames\": " << r.frames << ",\n";
+        os << "      \"setup_time_ms\": " << number(r.setup_time_ms) << ",\n";
+        os << "      \"setup_phases_ms\": " << phases_json(r.setup_phases) << ",\n";
+        os << "      \"teardown_time_ms\": " << number(r.teardown_time_ms) << ",\n";
+        if (r.frames_in_flight > 0)
+        {
+            os << "      \"frames_in_flight\": " << r.frames_in_flight << ",\n";
+            os << "      \"frame_wait_ms\": " << number(r.frame_wait_ms) << ",\n";
+            os << "      \"cpu_gpu_overlap\": " << number(r.cpu_gpu_overlap) << ",\n";
+        }
+        if (!r.metrics.empty())
+        {
+            os << "      \"metrics\": {";
+            for (size_t j = 0; j < r.metrics.size(); ++j)
+            {
+                os << (j == 0 ? "" : ", ")
+                   << json_string(r.metrics[j].first) << ": "
+                   << number(r.metrics[j].second);
+            }
+            os << "},\n";
+        }
+        os << "      \"frame_time_ms\": {"
+           << "\"mean\": " << number(r.frame_time_mean) << ", "
+           << "\"min\": " << number(r.frame_time_min) << ", "
+           << "\"median\": " << number(r.frame_time_median) << ", "
+           << "\"p90\": " << number(r.frame_time_p90) << ", "
+           << "\"p99\": " << number(r.frame_time_p99) << ", "
+           << "\"p99.9\": " << number(r.frame_time_p99_9) << ", "
+           << "\"max\": " << number(r.frame_time_max) << ", "
+           << "\"stddev\": " << number(r.frame_time_stddev) << "}";
+        if (r.gpu_time_samples > 0)
+        {
+            os << ",\n";
+            os << "      \"gpu_time_ms\": {"
+               << "\"samples\": " << r.gpu_time_samples << ", "
+               << "\"mean\": " << number(r.gpu_time_mean) << ", "
+               << "\"median\": " << number(r.gpu_time_median) << ", "
+               << "\"p99\": " << number(r.gpu_time_p99) << ", "
+               << "\"max\": " << number(r.gpu_time_max) << "}";
+        }
+        if (r.pipeline_stats_samples > 0)
+        {
+            os << ",\n";
+            os << "      \"pipeline_stats\": {"
+               << "\"samples\": " << r.pipeline_stats_samples << ", "
+               << "\"input_assembly_vertices\": " << number(r.input_assembly_vertices) << ", "
+               << "\"input_assembly_primitives\": " << number(r.input_assembly_primitives) << ", "
+               << "\"vertex_shader_invocations\": " << number(r.vertex_shader_invocations) << ", "
+               << "\"clipping_primitives\": " << number(r.clipping_primitives) << ", "
+               << "\"fragment_shader_invocations\": " << number(r.fragment_shader_invocations) << ", "
+               << "\"primitives_per_s\": " << number(r.input_assembly_primitives * r.fps) << ", "
+               << "\"fragments_per_s\": " << number(r.fragment_shader_invocations * r.fps) << "}";
+        }
+        if (r.has_energy)
+        {
+            os << ",\n";
+            os << "      \"energy\": {"
+               << "\"joules\": " << number(r.energy_j) << ", "
+               << "\"joules_per_frame\": " << number(r.energy_per_frame_j) << ", "
+               << "\"average_watts\": " << number(r.power_w) << "}";
+        }
+        if (r.has_cpu_usage)
+        {
+            auto const frames = r.frames > 0 ? r.frames : 1;
+
+            os << ",\n";
+            os << "      \"cpu\": {"
+               << "\"user_ms\": " << number(r.cpu_user_ms) << ", "
+               << "\"sys_ms\": " << number(r.cpu_sys_ms) << ", "
+               << "\"ms_per_frame\": " << number((r.cpu_user_ms + r.cpu_sys_ms) / frames) << ", "
+               << "\"voluntary_context_switches\": " << r.voluntary_context_switches << ", "
+               << "\"involuntary_context_switches\": " << r.involuntary_context_switches;
+            if (r.has_perf_counters)
+            {
+                os << ", "
+                   << "\"instructions\": " << r.instructions << ", "
+                   << "\"cycles\": " << r.cycles << ", "
+                   << "\"cache_misses\": " << r.cache_misses << ", "
+                   << "\"instructions_per_frame\": "
+                   << number(static_cast<double>(r.instructions) / frames);
+            }
+            os << "}";
+        }
+        if (r.has_memory_stats)
+        {
+            os << ",\n";
+            os << "      \"memory\": {"
+               << "\"device_setup_bytes\": " << r.device_memory_setup_bytes << ", "
+               << "\"device_peak_bytes\": " << r.device_memory_peak_bytes << ", "
+               << "\"host_rss_bytes\": " << r.host_rss_bytes << ", "
+               << "\"host_rss_peak_bytes\": " << r.host_rss_peak_bytes << ", "
+               << "\"heaps\": [";
+            for (size_t j = 0; j < r.heaps.size(); ++j)
+            {
+                auto const& heap = r.heaps[j];
+                os << (j == 0 ? "" : ", ")
+                   << "{\"allocated_bytes\": " << heap.allocated_bytes;
+                if (r.has_memory_budget)
+                {
+                    os << ", \"usage_before_setup\": " << heap.usage_before_setup
+                       << ", \"usage_after_setup\": " << heap.usage_after_setup
+                       << ", \"budget\": " << heap.budget;
+                }
+                os << "}";
+            }
+            os << "]}";
+        }
+        if (r.has_validation)
+        {
+            os << ",\n";
+            os << "      \"validation\": {"
+               << "\"valid\": " << (r.valid ? "true" : "false") << ", "
+               << "\"image_hash\": " << json_string(r.image_hash) << ", "
+               << "\"mismatched_pixels\": " << r.mismatched_pixels << "}";
+        }
+        os << "\n    }";
+    }
+
+    os << (results.empty() ? "],\n" : "\n  ],\n");
+    os << "  \"score_method\": " << json_string(run_info.score_method) << ",\n";
+    os << "  \"score\": " << number(score) << "\n";
+    os << "}\n";
+}
+
+void Results::write_csv(std::ostream& os,
+                        RunInfo const& run_info,
+                        std::vector<BenchmarkResult> const& results)
+{
+    os << "vkmark_version,window_system,present_mode,vendor_id,device_id,"
+          "device_name,driver_version,device_uuid,"
+          "scene,options,fps,duration_s,frames,"
+          "frame_time_mean_ms,frame_time_min_ms,frame_time_median_ms,"
+          "frame_time_p90_ms,frame_time_p99_ms,frame_time_p99.9_ms,"
+          "frame_time_max_ms,frame_time_stddev_ms,"
+          "gpu_time_mean_ms,gpu_time_median_ms,gpu_time_p99_ms,gpu_time_max_ms,"
+          "input_assembly_vertices,input_assembly_primitives,"
+          "vertex_shader_invocations,clipping_primitives,"
+          "fragment_shader_invocations,primitives_per_s,fragments_per_s,"
+          "energy_j,energy_per_frame_j,power_w,"
+          "cpu_user_ms,cpu_sys_ms,cpu_ms_per_frame,"
+          "voluntary_context_switches,involuntary_context_switches,"
+          "instructions,cycles,cache_misses,instructions_per_frame,"
+          "device_memory_setup_bytes,device_memory_peak_bytes,"
+          "host_rss_bytes,host_rss_peak_bytes,"
+          "setup_time_ms,teardown_time_ms,startup_time_ms,"
+          "frames_in_flight,frame_wait_ms,cpu_gpu_overlap,"
+          "valid,image_hash,mismatched_pixels,metrics\n";
+
+    for (auto const& r : results)
+    {
+        os << csv_string(run_info.vkmark_version) << ","
+           << csv_string(run_info.window_system) << ","
+           << csv_string(run_info.present_mode) << ","
+           << hex(run_info.vendor_id) << ","
+           << hex(run_info.device_id) << ","
+           << csv_string(run_info.device_name) << ","
+           << run_info.driver_version << ","
+           << csv_string(run_info.device_uuid) << ","
+           << csv_string(r.scene) << ","
+           << csv_string(options_string(r)) << ","
+           << r.fps << ","
+           << number(r.duration_s) << ","
+           << r.frames << ","
+           << number(r.frame_time_mean) << ","
+           << number(r.frame_time_min) << ","
+           << number(r.frame_time_median) << ","
+           << number(r.frame_time_p90) << ","
+           << number(r.frame_time_p99) << ","
+           << number(r.frame_time_p99_9) << ","
+           << number(r.frame_time_max) << ","
+           << number(r.frame_time_stddev);
+
+        if (r.gpu_time_samples > 0)
+        {
+            os << "," << number(r.gpu_time_mean)
+               << "," << number(r.gpu_time_median)
+               << "," << number(r.gpu_time_p99)
+               << "," << number(r.gpu_time_max);
+        }
+        else
+        {
+            os << ",,,,";
+        }
+
+        if (r.pipeline_stats_samples > 0)
+        {
+            os << "," << number(r.input_assembly_vertices)
+               << "," << number(r.input_assembly_primitives)
+               << "," << number(r.vertex_shader_invocations)
+               << "," << number(r.clipping_primitives)
+               << "," << number(r.fragment_shader_invocations)
+               << "," << number(r.input_assembly_primitives * r.fps)
+               << "," << number(r.fragment_shader_invocations * r.fps);
+        }
+        else
+        {
+            os << ",,,,,,,";
+        }
+
+        if (r.has_energy)
+        {
+            os << "," << number(r.energy_j)
+               << "," << number(r.energy_per_frame_j)
+               << "," << number(r.power_w);
+        }
+        else
+        {
+            os << ",,,";
+        }
+
+        if (r.has_cpu_usage)
+        {
+            auto const frames = r.frames > 0 ? r.frames : 1;
+
+            os << "," << number(r.cpu_user_ms)
+               << "," << number(r.cpu_sys_ms)
+               << "," << number((r.cpu_user_ms + r.cpu_sys_ms) / frames)
+               << "," << r.voluntary_context_switches
+               << "," << r.involuntary_context_switches;
+        }
+        else
+        {
+            os << ",,,,,";
+        }
+
+        if (r.has_perf_counters)
+        {
+            os << "," << r.instructions
+               << "," << r.cycles
+               << "," << r.cache_misses
+               << "," << number(static_cast<double>(r.instructions) / (r.frames > 0 ? r.frames : 1));
+        }
+        else
+        {
+            os << ",,,,";
+        }
+
+        if (r.has_memory_stats)
+        {
+            os << "," << r.device_memory_setup_bytes
+               << "," << r.device_memory_peak_bytes
+               << "," << r.host_rss_bytes
+               << "," << r.host_rss_peak_bytes;
+        }
+        else
+        {
+            os << ",,,,";
+        }
+
+        os << "," << number(r.setup_time_ms)
+           << "," << number(r.teardown_time_ms)
+           << "," << number(phases_total_ms(run_info.startup_phases));
+
+        if (r.frames_in_flight > 0)
+        {
+            os << "," << r.frames_in_flight
+               << "," << number(r.frame_wait_ms)
+               << "," << number(r.cpu_gpu_overlap);
+        }
+        else
+        {
+            os << ",,,";
+        }
+
+        if (r.has_validation)
+        {
+            os << "," << (r.valid ? "true" : "false")
+               << "," << r.image_hash
+               << "," << r.mismatched_pixels;
+        }
+        else
+        {
+            os << ",,,";
+        }
+
+        os << "," << csv_string(metrics_string(r));
+
+        os << "\n";
+    }
+}
+
+std::vector<BenchmarkResult> Results::read_json(std::istream& is)
+{
+    std::string const text{std::istreambuf_iterator<char>{is},
+                           std::istreambuf_iterator<char>{}};
+    auto const root = JsonParser{text}.parse();
+    auto const benchmarks = root.find("benchmarks");
+
+    if (!benchmarks || benchmarks->type != JsonValue::Type::array)
+        throw std::runtime_error{"Results contain no benchmarks"};
+
+    std::vector<BenchmarkResult> results;
+
+    for (auto const& b : benchmarks->array)
+    {
+        BenchmarkResult result{};
+
+        auto const scene = b.find("scene");
+        if (!scene || scene->type != JsonValue::Type::string)
+            throw std::runtime_error{"Results contain benchmark without scene"};
+
+        result.scene = scene->string;
+
+        if (auto const options = b.find("options"))
+        {
+            for (auto const& kv : options->object)
+                result.options.emplace_back(kv.first, kv.second.string);
+        }
+
+        result.description = "[" + result.scene + "]";
+        result.fps = b.number_or("fps", 0.0);
+        result.duration_s = b.number_or("duration_s", 0.0);
+        result.frames = b.number_or("frames", 0.0);
+        result.setup_time_ms = b.number_or("setup_time_ms", 0.0);
+        result.teardown_time_ms = b.number_or("teardown_time_ms", 0.0);
+        result.frames_in_flight = b.number_or("frames_in_flight", 0.0);
+        result.frame_wait_ms = b.number_or("frame_wait_ms", 0.0);
+        result.cpu_gpu_overlap = b.number_or("cpu_gpu_overlap", 0.0);
+
+        if (auto const metrics = b.find("metrics"))
+        {
+            for (auto const& kv : metrics->object)
+                result.metrics.emplace_back(kv.first, kv.second.number);
+        }
+
+        if (auto const phases = b.find("setup_phases_ms"))
+        {
+            for (auto const& kv : phases->object)
+            {
+                result.setup_phases.push_back(
+                    {kv.first, static_cast<uint64_t>(kv.second.number * 1000.0 + 0.5)});
+            }
+        }
+
+        if (auto const ft = b.find("frame_time_ms"))
+        {
+            result.frame_time_mean = ft->number_or("mean", 0.0);
+            result.frame_time_min = ft->number_or("min", 0.0);
+            result.frame_time_median = ft->number_or("median", 0.0);
+            result.frame_time_p90 = ft->number_or("p90", 0.0);
+            result.frame_time_p99 = ft->number_or("p99", 0.0);
+            result.frame_time_p99_9 = ft->number_or("p99.9", 0.0);
+            result.frame_time_max = ft->number_or("max", 0.0);
+            result.frame_time_stddev = ft->number_or("stddev", 0.0);
+        }
+
+        if (auto const gt = b.find("gpu_time_ms"))
+        {
+            result.gpu_time_samples = gt->number_or("samples", 0.0);
+            result.gpu_time_mean = gt->number_or("mean", 0.0);
+            result.gpu_time_median = gt->number_or("median", 0.0);
+            result.gpu_time_p99 = gt->number_or("p99", 0.0);
+            result.gpu_time_max = gt->number_or("max", 0.0);
+        }
+
+        if (auto const ps = b.find("pipeline_stats"))
+        {
+            result.pipeline_stats_samples = ps->number_or("samples", 0.0);
+            result.input_assembly_vertices = ps->number_or("input_assembly_vertices", 0.0);
+            result.input_assembly_primitives = ps->number_or("input_assembly_primitives", 0.0);
+            result.vertex_shader_invocations = ps->number_or("vertex_shader_invocations", 0.0);
+            result.clipping_primitives = ps->number_or("clipping_primitives", 0.0);
+            result.fragment_shader_invocations = ps->number_or("fragment_shader_invocations", 0.0);
+        }
+
+        if (auto const energy = b.find("energy"))
+        {
+            result.has_energy = true;
+            result.energy_j = energy->number_or("joules", 0.0);
+            result.energy_per_frame_j = energy->number_or("joules_per_frame", 0.0);
+            result.power_w = energy->number_or("average_watts", 0.0);
+        }
+
+        if (auto const cpu = b.find("cpu"))
+        {
+            result.has_cpu_usage = true;
+            result.cpu_user_ms = cpu->number_or("user_ms", 0.0);
+            result.cpu_sys_ms = cpu->number_or("sys_ms", 0.0);
+            result.voluntary_context_switches = cpu->number_or("voluntary_context_switches", 0.0);
+            result.involuntary_context_switches = cpu->number_or("involuntary_context_switches", 0.0);
+            result.has_perf_counters = cpu->find("instructions") != nullptr;
+            result.instructions = cpu->number_or("instructions", 0.0);
+            result.cycles = cpu->number_or("cycles", 0.0);
+            result.cache_misses = cpu->number_or("cache_misses", 0.0);
+        }
+
+        if (auto const memory = b.find("memory"))
+        {
+            result.has_memory_stats = true;
+            result.device_memory_setup_bytes = memory->number_or("device_setup_bytes", 0.0);
+            result.device_memory_peak_bytes = memory->number_or("device_peak_bytes", 0.0);
+            result.host_rss_bytes = memory->number_or("host_rss_bytes", 0.0);
+            result.host_rss_peak_bytes = memory->number_or("host_rss_peak_bytes", 0.0);
+
+            if (auto const heaps = memory->find("heaps"))
+            {
+                for (auto const& heap : heaps->array)
+                {
+                    result.has_memory_budget = heap.find("budget") != nullptr;
+                    result.heaps.push_back({
+                        static_cast<uint64_t>(heap.number_or("allocated_bytes", 0.0)),
+                        static_cast<uint64_t>(heap.number_or("usage_before_setup", 0.0)),
+                        static_cast<uint64_t>(heap.number_or("usage_after_setup", 0.0)),
+                        static_cast<uint64_t>(heap.number_or("budget", 0.0))});
+                }
+            }
+        }
+
+        if (auto const validation = b.find("validation"))
+        {
+            auto const valid = validation->find("valid");
+            auto const image_hash = validation->find("image_hash");
+
+            result.has_validation = true;
+            result.valid = valid && valid->boolean;
+            result.image_hash = image_hash ? image_hash->string : "";
+            result.mismatched_pixels = validation->number_or("mismatched_pixels", 0.0);
+        }
+
+        results.push_back(result);
+    }
+
+    return results;
+}
+
+void Results::write_file(std::string const& path,
+                         std::string const& format,
+                         RunInfo const& run_info,
+                         std::vector<BenchmarkResult> const& results,
+                         double score)
+{
+    std::ofstream ofs{path};
+
+    if (!ofs)
+        throw std::runtime_error{"Failed to open results file " + path};
+
+    if (format == "csv")
+        write_csv(ofs, run_info, results);
+    else
+        write_json(ofs, run_info, results, score);
+
+    if (!ofs)
+        throw std::runtime_error{"Failed to write results file " + path};
+}
+
+std::vector<BenchmarkResult> Results::read_file(std::string const& path)
+{
+    std::ifstream ifs{path};
+
+    if (!ifs)
+        throw std::runtime_error{"Failed to open results file " + path};
+
+    try
+    {
+        return read_json(ifs);
+    }
+    catch (std::exception const& e)
+    {
+        throw std::runtime_error{
+            "Failed to read results file " + path + ": " + e.what()};
+    }
+}
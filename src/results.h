@@ -0,0 +1,183 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "setup_timing.h"
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <utility>
+#include <vector>
+
+class Scene;
+
+struct BenchmarkResult
+{
+    static BenchmarkResult from_scene(Scene const& scene);
+
+    std::string scene;
+    // Scene name and explicitly set options, as shown when running
+    std::string description;
+    // All option values of the scene, sorted by option name
+    std::vector<std::pair<std::string, std::string>> options;
+    unsigned int fps;
+    double duration_s;
+    uint64_t frames;
+
+    // Duration of the scene setup() and teardown() in ms
+    double setup_time_ms;
+    double teardown_time_ms;
+    // Phases recorded by the scene during setup (durations in us)
+    std::vector<SetupTiming::Phase> setup_phases;
+
+    // Frame pipelining, only valid if frames_in_flight > 0
+    uint32_t frames_in_flight;
+    // Mean time per frame spent waiting for a frame slot to become available
+    double frame_wait_ms;
+    // Fraction of the run time the CPU was not blocked waiting for the GPU
+    // to release a frame slot
+    double cpu_gpu_overlap;
+
+    // Scene specific metrics (e.g. record_time_ms), in the order reported
+    // by the scene
+    std::vector<std::pair<std::string, double>> metrics;
+
+    // Frame times in ms
+    double frame_time_mean;
+    double frame_time_min;
+    double frame_time_median;
+    double frame_time_p90;
+    double frame_time_p99;
+    double frame_time_p99_9;
+    double frame_time_max;
+    double frame_time_stddev;
+
+    // GPU times in ms, only valid if gpu_time_samples > 0
+    uint64_t gpu_time_samples;
+    double gpu_time_mean;
+    double gpu_time_median;
+    double gpu_time_p99;
+    double gpu_time_max;
+
+    // Average pipeline statistics per frame, only valid if
+    // pipeline_stats_samples > 0
+    uint64_t pipeline_stats_samples;
+    double input_assembly_vertices;
+    double input_assembly_primitives;
+    double vertex_shader_invocations;
+    double clipping_primitives;
+    double fragment_shader_invocations;
+
+    // Host energy usage, only valid if has_energy is true
+    bool has_energy;
+    double energy_j;
+    double energy_per_frame_j;
+    double power_w;
+
+    // Process CPU usage, only valid if has_cpu_usage is true
+    bool has_cpu_usage;
+    double cpu_user_ms;
+    double cpu_sys_ms;
+    uint64_t voluntary_context_switches;
+    uint64_t involuntary_context_switches;
+    // Hardware counters, only valid if has_perf_counters is true
+    bool has_perf_counters;
+    uint64_t instructions;
+    uint64_t cycles;
+    uint64_t cache_misses;
+
+    struct HeapMemory
+    {
+        // Bytes allocated by the scene after setup
+        uint64_t allocated_bytes;
+        // Usage reported by VK_EXT_memory_budget, only valid if
+        // has_memory_budget is true
+        uint64_t usage_before_setup;
+        uint64_t usage_after_setup;
+        uint64_t budget;
+    };
+
+    // Memory usage, only valid if has_memory_stats is true
+    bool has_memory_stats;
+    uint64_t device_memory_setup_bytes;
+    uint64_t device_memory_peak_bytes;
+    uint64_t host_rss_bytes;
+    uint64_t host_rss_peak_bytes;
+    bool has_memory_budget;
+    std::vector<HeapMemory> heaps;
+
+    // Comparison of a frame with a reference image, only valid if
+    // has_validation is true, see ImageValidation
+    bool has_validation;
+    bool valid;
+    std::string image_hash;
+    uint64_t mismatched_pixels;
+};
+
+struct RunInfo
+{
+    std::string vkmark_version;
+    std::string window_system;
+    std::string present_mode;
+    uint32_t vendor_id;
+    uint32_t device_id;
+    std::string device_name;
+    uint32_t driver_version;
+    std::string device_uuid;
+    std::string score_method;
+    // Startup phases up to the first benchmark (durations in us)
+    std::vector<SetupTiming::Phase> startup_phases;
+};
+
+namespace Results
+{
+
+// A name for the files of a benchmark, derived from its description
+// without characters that are special in file names (e.g. "[cube]
+// present=thread" gives "cube_present=thread")
+std::string file_stem(std::string const& description);
+
+// Whether a and b are results of the same benchmark, i.e. they have the
+// same scene and the same values for the options present in both. Options
+// present in only one of them (e.g. options added in later versions) are
+// ignored, so that results from earlier versions still match.
+bool same_benchmark(BenchmarkResult const& a, BenchmarkResult const& b);
+
+void write_json(std::ostream& os,
+                RunInfo const& run_info,
+                std::vector<BenchmarkResult> const& results,
+                double score);
+void write_csv(std::ostream& os,
+               RunInfo const& run_info,
+               std::vector<BenchmarkResult> const& results);
+
+// Reads benchmark results previously written with write_json()
+std::vector<BenchmarkResult> read_json(std::istream& is);
+
+// Writes the results to a file in the specified format ("json" or "csv")
+void write_file(std::string const& path,
+                std::string const& format,
+                RunInfo const& run_info,
+                std::vector<BenchmarkResult> const& results,
+                double score);
+std::vector<BenchmarkResult> read_file(std::string const& path);
+
+}
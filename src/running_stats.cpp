@@ -0,0 +1,89 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "running_stats.h"
+
+#include <array>
+#include <cmath>
+
+namespace
+{
+
+// Two-sided 95% critical values of Student's t-distribution for 1-30
+// degrees of freedom. Larger degrees of freedom use the normal value.
+std::array<double, 30> const t_values{{
+    12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+    2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+    2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042}};
+
+double t_value95(uint64_t degrees_of_freedom)
+{
+    return degrees_of_freedom <= t_values.size() ?
+           t_values[degrees_of_freedom - 1] : 1.960;
+}
+
+}
+
+RunningStats::RunningStats()
+{
+    reset();
+}
+
+void RunningStats::reset()
+{
+    count_ = 0;
+    mean_ = 0.0;
+    m2 = 0.0;
+}
+
+void RunningStats::add(double sample)
+{
+    ++count_;
+    auto const delta = sample - mean_;
+    mean_ += delta / count_;
+    m2 += delta * (sample - mean_);
+}
+
+uint64_t RunningStats::count() const
+{
+    return count_;
+}
+
+double RunningStats::mean() const
+{
+    return mean_;
+}
+
+double RunningStats::stddev() const
+{
+    return count_ > 1 ? std::sqrt(m2 / (count_ - 1)) : 0.0;
+}
+
+double RunningStats::cv() const
+{
+    return mean_ != 0.0 ? stddev() / std::fabs(mean_) : 0.0;
+}
+
+double RunningStats::confidence_interval95() const
+{
+    if (count_ < 2)
+        return 0.0;
+
+    return t_value95(count_ - 1) * stddev() / std::sqrt(count_);
+}
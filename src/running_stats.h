@@ -0,0 +1,46 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+// Accumulates the mean and variance of a series of samples in a single pass
+// (Welford's algorithm), without storing the samples.
+class RunningStats
+{
+public:
+    RunningStats();
+
+    void reset();
+    void add(double sample);
+
+    uint64_t count() const;
+    double mean() const;
+    double stddev() const;
+    // Coefficient of variation (stddev / mean)
+    double cv() const;
+    // Half-width of the 95% confidence interval of the mean
+    double confidence_interval95() const;
+
+private:
+    uint64_t count_;
+    double mean_;
+    double m2;
+};
@@ -21,9 +21,14 @@
  */
 
 #include "scene.h"
+#include "frame_slots.h"
+#include "gpu_timer.h"
+#include "pipeline_statistics_query.h"
 #include "vulkan_image.h"
+#include "vulkan_state.h"
 #include "util.h"
 #include "options.h"
+#include "log.h"
 
 SceneOption::SceneOption(std::string const& name,
                          std::string const& value,
@@ -48,32 +53,141 @@ bool SceneOption::accepts_value(std::string const& val)
 Scene::Scene(std::string const& name)
     : name_{name},
       start_time{0}, last_update_time{0}, current_frame{0},
-      running{false}, duration{0}
+      running{false}, duration{0}, fixed_frames{0}, timestep{0.0}, animation_frame{0},
+      warming_up{false}, warmup_duration{0}, warmup_frames{0},
+      adaptive_cv{0.0}, adaptive_window{0}, adaptive_min_duration{0},
+      window_start_time{0}, window_start_frame{0}, adaptive_converged{false},
+      pipeline_stats_total_{}, pipeline_stats_samples_{0},
+      num_frame_slots_{0}, use_timeline{false}
 {
     options_["duration"] = SceneOption("duration", "10.0",
                                       "The duration of each benchmark in seconds");
+    options_["frames"] = SceneOption("frames", "0",
+                                    "The number of frames of each benchmark"
+                                    " (0 to run for 'duration' seconds)");
+    options_["timestep"] = SceneOption("timestep", "0.0",
+                                      "The animation time between frames in seconds"
+                                      " (0.0 to animate in real time)");
+    options_["warmup"] = SceneOption("warmup", "0.0",
+                                    "The duration of the unmeasured warm-up phase in seconds");
+    options_["warmup-frames"] = SceneOption("warmup-frames", "0",
+                                           "The minimum number of frames in the warm-up phase");
+    options_["adaptive-cv"] = SceneOption("adaptive-cv", "0.0",
+                                         "Stop when the coefficient of variation of the FPS of"
+                                         " each sample window drops below this value"
+                                         " (0.0 to disable, 'duration' is the maximum duration)");
+    options_["adaptive-window"] = SceneOption("adaptive-window", "0.5",
+                                             "The duration of each adaptive sample window in seconds");
+    options_["adaptive-min-duration"] = SceneOption("adaptive-min-duration", "2.0",
+                                                   "The minimum duration of adaptive benchmarks in seconds");
+    options_["gpu-timing"] = SceneOption("gpu-timing", "false",
+                                        "Whether to measure the GPU time of each frame",
+                                        "false,true");
+    options_["pipeline-stats"] = SceneOption("pipeline-stats", "false",
+                                            "Whether to collect pipeline statistics for each frame",
+                                            "false,true");
+    options_["frames-in-flight"] = SceneOption("frames-in-flight", "0",
+                                              "The number of frames that can be processed concurrently"
+                                              " (0 for one per swapchain image)");
+    options_["sync"] = SceneOption("sync", "fence",
+                                  "How to wait for frames to complete (timeline also measures"
+                                  " the GPU completion latency)",
+                                  "fence,timeline");
+    options_["present"] = SceneOption("present", "inline",
+                                     "Whether to acquire and present images on the rendering"
+                                     " thread or on a dedicated present thread",
+                                     "inline,thread");
 }
 
+Scene::~Scene() = default;
+
 bool Scene::is_valid() const
 {
     return true;
 }
 
-void Scene::setup(VulkanState&, std::vector<VulkanImage> const&)
+void Scene::setup(VulkanState& vulkan, std::vector<VulkanImage> const& images)
 {
+    setup_timing_.reset();
+
     duration = 1000000.0 * Util::from_string<double>(options_["duration"].value);
+    fixed_frames = Util::from_string<uint64_t>(options_["frames"].value);
+    timestep = 1000000.0 * Util::from_string<double>(options_["timestep"].value);
+    warmup_duration = 1000000.0 * Util::from_string<double>(options_["warmup"].value);
+    warmup_frames = Util::from_string<uint64_t>(options_["warmup-frames"].value);
+    adaptive_cv = Util::from_string<double>(options_["adaptive-cv"].value);
+    adaptive_window = 1000000.0 * Util::from_string<double>(options_["adaptive-window"].value);
+    adaptive_min_duration =
+        1000000.0 * Util::from_string<double>(options_["adaptive-min-duration"].value);
+
+    auto const frames_in_flight =
+        Util::from_string<uint32_t>(options_["frames-in-flight"].value);
+    num_frame_slots_ = frames_in_flight > 0 ? frames_in_flight : images.size();
+
+    use_timeline = false;
+    if (options_["sync"].value == "timeline")
+    {
+        if (vulkan.timeline_semaphores_supported())
+        {
+            use_timeline = true;
+        }
+        else
+        {
+            Log::warning("Scene '%s': Timeline semaphores are not supported by the device,"
+                         " using fences\n",
+                         name_.c_str());
+        }
+    }
+
+    if (options_["gpu-timing"].value == "true")
+    {
+        if (GPUTimer::is_supported(vulkan))
+        {
+            gpu_timer = std::make_unique<GPUTimer>(vulkan, num_frame_slots_);
+        }
+        else
+        {
+            Log::warning("Scene '%s': GPU timing is not supported by the graphics queue\n",
+                         name_.c_str());
+        }
+    }
+
+    if (options_["pipeline-stats"].value == "true")
+    {
+        if (PipelineStatisticsQuery::is_supported(vulkan))
+        {
+            pipeline_stats_query = std::make_unique<PipelineStatisticsQuery>(vulkan, num_frame_slots_);
+        }
+        else
+        {
+            Log::warning("Scene '%s': Pipeline statistics are not supported by the device\n",
+                         name_.c_str());
+        }
+    }
 }
 
 void Scene::teardown()
 {
+    gpu_timer.reset();
+    pipeline_stats_query.reset();
+    frame_slots.reset();
 }
 
 void Scene::start()
 {
     current_frame = 0;
+    animation_frame = 0;
     running = true;
     start_time = Util::get_timestamp_us();
     last_update_time = start_time;
+    frame_time_stats_.reset();
+    gpu_time_stats_.reset();
+    pipeline_stats_total_ = {};
+    pipeline_stats_samples_ = 0;
+    if (frame_slots)
+        frame_slots->reset_stats();
+    warming_up = warmup_duration > 0 || warmup_frames > 0;
+    reset_adaptive_windows();
 }
 
 VulkanImage Scene::draw(VulkanImage const& image)
@@ -87,11 +201,87 @@ void Scene::update()
     auto const elapsed_time = current_time - start_time;
 
     ++current_frame;
+    ++animation_frame;
 
+    frame_time_stats_.record(current_time - last_update_time);
     last_update_time = current_time;
 
-    if (elapsed_time >= duration)
+    if (warming_up)
+    {
+        // Restart the measurement when the warm-up phase ends, so that
+        // the warm-up frames don't affect the results
+        if (elapsed_time >= warmup_duration && current_frame >= warmup_frames)
+        {
+            warming_up = false;
+            current_frame = 0;
+            start_time = current_time;
+            frame_time_stats_.reset();
+            gpu_time_stats_.reset();
+            pipeline_stats_total_ = {};
+            pipeline_stats_samples_ = 0;
+            if (frame_slots)
+                frame_slots->reset_stats();
+            reset_adaptive_windows();
+        }
+    }
+    else if (fixed_frames > 0)
+    {
+        if (current_frame >= fixed_frames)
+            running = false;
+    }
+    else
+    {
+        if (is_adaptive())
+            update_adaptive_windows(current_time, elapsed_time);
+
+        if (elapsed_time >= duration)
+            running = false;
+    }
+}
+
+double Scene::animation_time() const
+{
+    if (timestep > 0.0)
+        return (animation_frame + 1) * timestep;
+
+    return Util::get_timestamp_us() - start_time;
+}
+
+double Scene::animation_time_delta() const
+{
+    if (timestep > 0.0)
+        return timestep;
+
+    return Util::get_timestamp_us() - last_update_time;
+}
+
+void Scene::reset_adaptive_windows()
+{
+    window_start_time = start_time;
+    window_start_frame = current_frame;
+    window_fps_stats_.reset();
+    adaptive_converged = false;
+}
+
+void Scene::update_adaptive_windows(uint64_t current_time, uint64_t elapsed_time)
+{
+    auto const window_time = current_time - window_start_time;
+
+    if (window_time < adaptive_window || window_time == 0)
+        return;
+
+    window_fps_stats_.add((current_frame - window_start_frame) * 1000000.0 / window_time);
+    window_start_time = current_time;
+    window_start_frame = current_frame;
+
+    // Require a few windows for the variation to be meaningful
+    if (elapsed_time >= adaptive_min_duration &&
+        window_fps_stats_.count() >= 3 &&
+        window_fps_stats_.cv() <= adaptive_cv)
+    {
+        adaptive_converged = true;
         running = false;
+    }
 }
 
 std::string Scene::name() const
@@ -128,11 +318,91 @@ unsigned int Scene::average_fps() const
            current_frame * 1000000 / (last_update_time - start_time) : 0;
 }
 
+uint64_t Scene::num_frames() const
+{
+    return current_frame;
+}
+
+uint64_t Scene::elapsed_time() const
+{
+    return last_update_time > start_time ? last_update_time - start_time : 0;
+}
+
+FrameTimeStats const& Scene::frame_time_stats() const
+{
+    return frame_time_stats_;
+}
+
+FrameTimeStats const& Scene::gpu_time_stats() const
+{
+    return gpu_time_stats_;
+}
+
+PipelineStatistics const& Scene::pipeline_stats_total() const
+{
+    return pipeline_stats_total_;
+}
+
+uint64_t Scene::pipeline_stats_samples() const
+{
+    return pipeline_stats_samples_;
+}
+
+SetupTiming const& Scene::setup_timing() const
+{
+    return setup_timing_;
+}
+
+uint32_t Scene::frames_in_flight() const
+{
+    return frame_slots ? frame_slots->num_slots() : 0;
+}
+
+uint64_t Scene::frame_wait_time() const
+{
+    return frame_slots ? frame_slots->wait_time() : 0;
+}
+
+FrameProgress const* Scene::frame_progress() const
+{
+    return frame_slots && frame_slots->uses_timeline() ? &frame_slots->progress() : nullptr;
+}
+
+std::vector<std::pair<std::string, double>> Scene::metrics() const
+{
+    return {};
+}
+
 bool Scene::is_running() const
 {
     return running;
 }
 
+bool Scene::is_warming_up() const
+{
+    return warming_up;
+}
+
+bool Scene::is_adaptive() const
+{
+    return adaptive_cv > 0.0 && fixed_frames == 0;
+}
+
+bool Scene::is_fixed_frames() const
+{
+    return fixed_frames > 0;
+}
+
+bool Scene::has_converged() const
+{
+    return adaptive_converged;
+}
+
+RunningStats const& Scene::window_fps_stats() const
+{
+    return window_fps_stats_;
+}
+
 bool Scene::set_option(std::string const& opt, std::string const& val)
 {
     auto const iter = options_.find(opt);
@@ -175,3 +445,66 @@ std::unordered_map<std::string, SceneOption> const& Scene::options() const
 {
     return options_;
 }
+
+void Scene::begin_gpu_queries(vk::CommandBuffer const& command_buffer, uint32_t index)
+{
+    if (gpu_timer)
+        gpu_timer->write_start(command_buffer, index);
+    if (pipeline_stats_query)
+        pipeline_stats_query->begin(command_buffer, index);
+}
+
+void Scene::end_gpu_queries(vk::CommandBuffer const& command_buffer, uint32_t index)
+{
+    if (pipeline_stats_query)
+        pipeline_stats_query->end(command_buffer, index);
+    if (gpu_timer)
+        gpu_timer->write_end(command_buffer, index);
+}
+
+void Scene::collect_gpu_queries(uint32_t index)
+{
+    if (gpu_timer)
+    {
+        if (auto const gpu_time = gpu_timer->collect(index))
+            gpu_time_stats_.record(*gpu_time);
+    }
+
+    if (pipeline_stats_query)
+    {
+        if (auto const stats = pipeline_stats_query->collect(index))
+        {
+            pipeline_stats_total_ += *stats;
+            ++pipeline_stats_samples_;
+        }
+    }
+}
+
+void Scene::setup_frame_slots(VulkanState& vulkan)
+{
+    frame_slots = std::make_unique<FrameSlots>(vulkan, num_frame_slots_, use_timeline);
+}
+
+uint32_t Scene::num_frame_slots() const
+{
+    return num_frame_slots_;
+}
+
+uint32_t Scene::next_frame_slot()
+{
+    return frame_slots->next();
+}
+
+VulkanImage Scene::submit_frame(vk::CommandBuffer const& command_buffer,
+                                VulkanImage const& image)
+{
+    return frame_slots->submit(command_buffer, image);
+}
+
+VulkanImage Scene::submit_frame(vk::CommandBuffer const& command_buffer,
+                                VulkanImage const& image,
+                                vk::Semaphore const& wait_semaphore)
+{
+    return frame_slots->submit(command_buffer, image, wait_semaphore,
+                               vk::PipelineStageFlagBits::eVertexInput);
+}
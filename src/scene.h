@@ -22,10 +22,17 @@
 
 #pragma once
 
+#include "frame_time_stats.h"
+#include "pipeline_statistics.h"
+#include "running_stats.h"
+#include "setup_timing.h"
+
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 #include <unordered_map>
+#include <utility>
 
 class SceneOption
 {
@@ -48,11 +55,16 @@ public:
 
 class VulkanState;
 struct VulkanImage;
+class GPUTimer;
+class FrameProgress;
+class FrameSlots;
+class PipelineStatisticsQuery;
+namespace vk { class CommandBuffer; class Semaphore; }
 
 class Scene
 {
 public:
-    virtual ~Scene() = default;
+    virtual ~Scene();
 
     virtual bool is_valid() const;
     virtual void setup(VulkanState&, std::vector<VulkanImage> const&);
@@ -65,7 +77,39 @@ public:
     std::string name() const;
     std::string info_string(bool show_all_options) const;
     unsigned int average_fps() const;
+    uint64_t num_frames() const;
+    // Measured time in microseconds
+    uint64_t elapsed_time() const;
+    FrameTimeStats const& frame_time_stats() const;
+    // GPU times in nanoseconds, only recorded when gpu-timing is enabled
+    FrameTimeStats const& gpu_time_stats() const;
+    // Sum of the pipeline statistics of all sampled frames, only recorded
+    // when pipeline-stats is enabled
+    PipelineStatistics const& pipeline_stats_total() const;
+    uint64_t pipeline_stats_samples() const;
+    // Durations of the phases of the last setup() (e.g. model, texture,
+    // pipeline), as recorded by the scene
+    SetupTiming const& setup_timing() const;
+    // Number of frames the scene pipelines, 0 if the scene doesn't use
+    // frame slots
+    uint32_t frames_in_flight() const;
+    // Time in microseconds spent waiting for frame slots to become available
+    uint64_t frame_wait_time() const;
+    // GPU progress through the submitted frames, only tracked with
+    // sync=timeline, nullptr otherwise
+    FrameProgress const* frame_progress() const;
+    // Additional named measurements specific to the scene, reported along
+    // with the standard results
+    virtual std::vector<std::pair<std::string, double>> metrics() const;
     bool is_running() const;
+    bool is_warming_up() const;
+    bool is_adaptive() const;
+    // Whether the scene renders a fixed number of frames (frames option)
+    // instead of running for a duration
+    bool is_fixed_frames() const;
+    bool has_converged() const;
+    // FPS of each sample window, only recorded in adaptive mode
+    RunningStats const& window_fps_stats() const;
 
     bool set_option(std::string const& opt, std::string const& val);
     void reset_options();
@@ -75,6 +119,37 @@ public:
 protected:
     Scene(std::string const& name);
 
+    // Record the enabled GPU queries (gpu-timing, pipeline-stats) around
+    // the commands of a frame. Both must be called outside of a render pass.
+    void begin_gpu_queries(vk::CommandBuffer const& command_buffer, uint32_t index);
+    void end_gpu_queries(vk::CommandBuffer const& command_buffer, uint32_t index);
+    // Must be called before each submission of the frame's command buffer
+    void collect_gpu_queries(uint32_t index);
+    // Creates num_frame_slots() frame slots. Scenes keep per-slot resources
+    // (command buffers, uniform buffers) and use next_frame_slot() to wait
+    // until the resources of the next slot can be reused.
+    void setup_frame_slots(VulkanState& vulkan);
+    uint32_t num_frame_slots() const;
+    uint32_t next_frame_slot();
+    // Submits the command buffer of the current frame slot and returns the
+    // image to present
+    VulkanImage submit_frame(vk::CommandBuffer const& command_buffer,
+                             VulkanImage const& image);
+    // As above, but also waits for wait_semaphore before vertex input, e.g.
+    // for compute work submitted to another queue
+    VulkanImage submit_frame(vk::CommandBuffer const& command_buffer,
+                             VulkanImage const& image,
+                             vk::Semaphore const& wait_semaphore);
+    // Animation time in microseconds of the next frame, for use in update()
+    // before calling Scene::update(). With a fixed timestep it depends only
+    // on the number of frames since start(), so every run renders the same
+    // sequence of frames.
+    double animation_time() const;
+    // Animation time in microseconds between the last and the next frame
+    double animation_time_delta() const;
+    void reset_adaptive_windows();
+    void update_adaptive_windows(uint64_t current_time, uint64_t elapsed_time);
+
     std::string const name_;
     std::unordered_map<std::string,SceneOption> options_;
     uint64_t start_time;
@@ -82,4 +157,28 @@ protected:
     uint64_t current_frame;
     bool running;
     uint64_t duration;
+    uint64_t fixed_frames;
+    double timestep;
+    // Frames since start(), including warm-up frames
+    uint64_t animation_frame;
+    bool warming_up;
+    uint64_t warmup_duration;
+    uint64_t warmup_frames;
+    double adaptive_cv;
+    uint64_t adaptive_window;
+    uint64_t adaptive_min_duration;
+    uint64_t window_start_time;
+    uint64_t window_start_frame;
+    bool adaptive_converged;
+    RunningStats window_fps_stats_;
+    FrameTimeStats frame_time_stats_;
+    FrameTimeStats gpu_time_stats_;
+    std::unique_ptr<GPUTimer> gpu_timer;
+    PipelineStatistics pipeline_stats_total_;
+    uint64_t pipeline_stats_samples_;
+    std::unique_ptr<PipelineStatisticsQuery> pipeline_stats_query;
+    SetupTiming setup_timing_;
+    uint32_t num_frame_slots_;
+    bool use_timeline;
+    std::unique_ptr<FrameSlots> frame_slots;
 };
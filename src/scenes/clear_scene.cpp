@@ -41,15 +41,14 @@ void ClearScene::setup(VulkanState& vulkan_, std::vector<VulkanImage> const& ima
 
     vulkan = &vulkan_;
 
+    setup_frame_slots(*vulkan);
+
     auto const command_buffer_allocate_info = vk::CommandBufferAllocateInfo{}
         .setCommandPool(vulkan->command_pool())
-        .setCommandBufferCount(images.size())
+        .setCommandBufferCount(num_frame_slots())
         .setLevel(vk::CommandBufferLevel::ePrimary);
 
     command_buffers = vulkan->device().allocateCommandBuffers(command_buffer_allocate_info);
-    command_buffer_fences.resize(command_buffers.size());
-
-    submit_semaphore = vkutil::SemaphoreBuilder{*vulkan}.build();
 
     if (options_["color"].value == "cycle")
     {
@@ -77,20 +76,12 @@ void ClearScene::teardown()
 {
     vulkan->device().waitIdle();
 
-    submit_semaphore = {};
-    for (auto const& fence : command_buffer_fences)
-    {
-        if (fence)
-            vulkan->device().destroyFence(fence);
-    }
-    command_buffer_fences.clear();
-
     vulkan->device().freeCommandBuffers(vulkan->command_pool(), command_buffers);
 
     Scene::teardown();
 }
 
-void ClearScene::prepare_command_buffer(VulkanImage const& image)
+void ClearScene::prepare_command_buffer(VulkanImage const& image, uint32_t slot)
 {
     auto const begin_info = vk::CommandBufferBeginInfo{}
         .setFlags(vk::CommandBufferUsageFlagBits::eSimultaneousUse);
@@ -122,22 +113,10 @@ void ClearScene::prepare_command_buffer(VulkanImage const& image)
         .setDstQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
         .setSubresourceRange(image_range);
 
-    auto const i = image.index;
-
-    if (!image.submit_fence)
-    {
-        if (!command_buffer_fences[i])
-        {
-            command_buffer_fences[i] = vulkan->device().createFence(vk::FenceCreateInfo());
-        }
-        else
-        {
-            (void)vulkan->device().waitForFences(command_buffer_fences[i], true, INT64_MAX);
-            vulkan->device().resetFences(command_buffer_fences[i]);
-        }
-    }
+    auto const i = slot;
 
     command_buffers[i].begin(begin_info);
+    begin_gpu_queries(command_buffers[i], i);
 
     command_buffers[i].pipelineBarrier(
         vk::PipelineStageFlagBits::eTransfer,
@@ -157,33 +136,24 @@ void ClearScene::prepare_command_buffer(VulkanImage const& image)
         {}, {}, {},
         transfer_to_present_barrier);
 
+    end_gpu_queries(command_buffers[i], i);
     command_buffers[i].end();
 }
 
 VulkanImage ClearScene::draw(VulkanImage const& image)
 {
-    prepare_command_buffer(image);
-
-    vk::PipelineStageFlags mask = vk::PipelineStageFlagBits::eColorAttachmentOutput;
-    auto const submit_info = vk::SubmitInfo{}
-        .setSignalSemaphoreCount(image.semaphore ? 1 : 0)
-        .setPSignalSemaphores(&submit_semaphore.raw)
-        .setCommandBufferCount(1)
-        .setPCommandBuffers(&command_buffers[image.index])
-        .setWaitSemaphoreCount(image.semaphore ? 1 : 0)
-        .setPWaitSemaphores(&image.semaphore)
-        .setPWaitDstStageMask(&mask);
-
-    vulkan->graphics_queue().submit(submit_info,
-        image.submit_fence ? image.submit_fence :
-                             command_buffer_fences[image.index]);
-
-    return image.copy_with_semaphore(submit_semaphore);
+    auto const slot = next_frame_slot();
+
+    prepare_command_buffer(image, slot);
+
+    collect_gpu_queries(slot);
+
+    return submit_frame(command_buffers[slot], image);
 }
 
 void ClearScene::update()
 {
-    auto const elapsed = Util::get_timestamp_us() - start_time;
+    auto const elapsed = animation_time();
 
     if (cycle)
     {
@@ -23,7 +23,6 @@
 #pragma once
 
 #include "scene.h"
-#include "managed_resource.h"
 
 #include <vulkan/vulkan.hpp>
 
@@ -39,12 +38,10 @@ public:
     void update() override;
 
 private:
-    void prepare_command_buffer(VulkanImage const& image);
+    void prepare_command_buffer(VulkanImage const& image, uint32_t slot);
 
     VulkanState* vulkan;
     std::vector<vk::CommandBuffer> command_buffers;
-    std::vector<vk::Fence> command_buffer_fences;
-    ManagedResource<vk::Semaphore> submit_semaphore;
     vk::ClearColorValue clear_color;
     bool cycle;
 };
@@ -0,0 +1,443 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "compute_scene.h"
+
+#include "mesh.h"
+#include "model.h"
+#include "util.h"
+#include "log.h"
+#include "vulkan_state.h"
+#include "vulkan_image.h"
+#include "vkutil/vkutil.h"
+
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/matrix_inverse.hpp>
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <random>
+
+namespace
+{
+
+struct Uniforms
+{
+    glm::mat4 modelview;
+    glm::mat4 modelviewprojection;
+    glm::mat4 normal;
+};
+
+// Must match local_size_x in particles.comp
+uint32_t const workgroup_size = 64;
+
+}
+
+ComputeScene::ComputeScene() : Scene{"compute"}, async{false}, uses_compute_queue{false}
+{
+    options_["queue"] = SceneOption("queue", "async",
+                                    "Where to run the particle simulation",
+                                    "async,serial");
+    options_["particles"] = SceneOption("particles", "1048576",
+                                        "The number of simulated particles");
+    options_["dispatches"] = SceneOption("dispatches", "4",
+                                         "The number of simulation steps in each frame");
+    options_["draws"] = SceneOption("draws", "16",
+                                    "The number of times the cube is drawn in each frame");
+}
+
+ComputeScene::~ComputeScene() = default;
+
+void ComputeScene::setup(
+    VulkanState& vulkan_,
+    std::vector<VulkanImage> const& vulkan_images)
+{
+    Scene::setup(vulkan_, vulkan_images);
+
+    vulkan = &vulkan_;
+    extent = vulkan_images[0].extent;
+    format = vulkan_images[0].format;
+
+    // The shader doesn't check bounds, so simulate whole workgroups
+    auto const max_workgroups =
+        vulkan->physical_device().getProperties().limits.maxComputeWorkGroupCount[0];
+    auto const requested_particles =
+        std::max(1u, Util::from_string<unsigned int>(options_["particles"].value));
+    auto const num_workgroups = std::min(
+        (requested_particles + workgroup_size - 1) / workgroup_size, max_workgroups);
+    num_particles = num_workgroups * workgroup_size;
+    num_dispatches = Util::from_string<unsigned int>(options_["dispatches"].value);
+    num_draws = Util::from_string<unsigned int>(options_["draws"].value);
+    async = options_["queue"].value == "async";
+    uses_compute_queue = async && vulkan->has_async_compute_queue();
+
+    if (async && !uses_compute_queue)
+    {
+        Log::debug("ComputeScene: No dedicated compute queue, submitting "
+                   "compute work separately to the graphics queue\n");
+    }
+
+    mesh = setup_timing_.timed("model", [] {
+        return Model{"kmscube.ply"}.to_mesh(
+            ModelAttribMap{}
+                .with_position(vk::Format::eR32G32B32Sfloat)
+                .with_color(vk::Format::eR32G32B32Sfloat)
+                .with_normal(vk::Format::eR32G32B32Sfloat));
+    });
+
+    setup_vertex_buffer();
+    setup_uniform_buffer();
+    setup_particle_buffer();
+    setup_frame_slots(*vulkan);
+    setup_render_pass();
+    setup_timing_.timed("pipeline", [this] { setup_pipelines(); });
+    setup_framebuffers(vulkan_images);
+    setup_command_buffers();
+}
+
+void ComputeScene::teardown()
+{
+    vulkan->device().waitIdle();
+
+    compute_semaphores.clear();
+    compute_command_buffers.clear();
+    compute_command_pool = {};
+    vulkan->device().freeCommandBuffers(vulkan->command_pool(), command_buffers);
+    framebuffers.clear();
+    image_views.clear();
+    compute_pipeline = {};
+    compute_pipeline_layout = {};
+    compute_descriptor_set = {};
+    pipeline = {};
+    pipeline_layout = {};
+    render_pass = {};
+    descriptor_set = {};
+    particle_buffer = {};
+    uniform_buffer = {};
+    vertex_buffer = {};
+
+    Scene::teardown();
+}
+
+VulkanImage ComputeScene::draw(VulkanImage const& image)
+{
+    auto const slot = next_frame_slot();
+    auto const index = slot * framebuffers.size() + image.index;
+
+    collect_gpu_queries(slot);
+
+    if (!async)
+        return submit_frame(command_buffers[index], image);
+
+    auto const submit_info = vk::SubmitInfo{}
+        .setCommandBufferCount(1)
+        .setPCommandBuffers(&compute_command_buffers[slot])
+        .setSignalSemaphoreCount(1)
+        .setPSignalSemaphores(&compute_semaphores[slot].raw);
+
+    {
+        std::lock_guard<std::mutex> const lock{vulkan->queue_mutex()};
+        vulkan->compute_queue().submit(submit_info, {});
+    }
+
+    // Rendering of this frame waits for its compute work, which can still
+    // overlap with rendering of the previous frames in flight. The frame
+    // slot fence thus also covers the compute command buffer.
+    return submit_frame(command_buffers[index], image, compute_semaphores[slot]);
+}
+
+std::vector<std::pair<std::string, double>> ComputeScene::metrics() const
+{
+    double const particle_updates =
+        static_cast<double>(num_particles) * num_dispatches * average_fps();
+
+    return {{"particle_updates_per_s", particle_updates},
+            {"async_compute_queue", uses_compute_queue ? 1.0 : 0.0}};
+}
+
+void ComputeScene::setup_vertex_buffer()
+{
+    vk::DeviceMemory vertex_buffer_memory;
+
+    vertex_buffer = vkutil::BufferBuilder{*vulkan}
+        .set_size(mesh->vertex_data_size())
+        .set_usage(vk::BufferUsageFlagBits::eVertexBuffer)
+        .set_memory_properties(
+            vk::MemoryPropertyFlagBits::eHostVisible |
+            vk::MemoryPropertyFlagBits::eHostCoherent)
+        .set_memory_out(vertex_buffer_memory)
+        .build();
+
+    auto const vertex_buffer_map = vkutil::map_memory(
+        *vulkan, vertex_buffer_memory, 0, mesh->vertex_data_size());
+    mesh->copy_vertex_data_to(vertex_buffer_map);
+}
+
+void ComputeScene::setup_uniform_buffer()
+{
+    vk::DeviceMemory uniform_buffer_memory;
+
+    uniform_buffer = vkutil::BufferBuilder{*vulkan}
+        .set_size(sizeof(Uniforms))
+        .set_usage(vk::BufferUsageFlagBits::eUniformBuffer)
+        .set_memory_properties(
+            vk::MemoryPropertyFlagBits::eHostVisible |
+            vk::MemoryPropertyFlagBits::eHostCoherent)
+        .set_memory_out(uniform_buffer_memory)
+        .build();
+
+    // The cube is static, the per-frame work is in the simulation
+    auto const aspect = static_cast<float>(extent.height) / extent.width;
+    auto const projection = glm::frustum(-2.8f, 2.8f, -2.8f * aspect, 2.8f * aspect, 6.0f, 10.0f);
+
+    Uniforms ubo;
+
+    ubo.modelview = glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, -8.0f));
+    ubo.modelview = glm::rotate(ubo.modelview, glm::radians(45.0f), {1.0f, 0.0f, 0.0f});
+    ubo.modelview = glm::rotate(ubo.modelview, glm::radians(45.0f), {0.0f, 1.0f, 0.0f});
+    ubo.modelviewprojection = projection * ubo.modelview;
+    ubo.normal = glm::inverseTranspose(ubo.modelview);
+
+    auto const uniform_buffer_map = vkutil::map_memory(
+        *vulkan, uniform_buffer_memory, 0, sizeof(Uniforms));
+    memcpy(uniform_buffer_map, &ubo, sizeof(ubo));
+
+    descriptor_set = vkutil::DescriptorSetBuilder{*vulkan}
+        .set_type(vk::DescriptorType::eUniformBuffer)
+        .set_stage_flags(vk::ShaderStageFlagBits::eVertex)
+        .set_buffer(uniform_buffer, 0, sizeof(Uniforms))
+        .set_layout_out(descriptor_set_layout)
+        .build();
+}
+
+void ComputeScene::setup_particle_buffer()
+{
+    auto const size = num_particles * sizeof(glm::vec4);
+    vk::DeviceMemory staging_buffer_memory;
+
+    auto staging_buffer = vkutil::BufferBuilder{*vulkan}
+        .set_size(size)
+        .set_usage(vk::BufferUsageFlagBits::eTransferSrc)
+        .set_memory_properties(
+            vk::MemoryPropertyFlagBits::eHostVisible |
+            vk::MemoryPropertyFlagBits::eHostCoherent)
+        .set_memory_out(staging_buffer_memory)
+        .build();
+
+    {
+        auto const staging_buffer_map = vkutil::map_memory(
+            *vulkan, staging_buffer_memory, 0, size);
+        auto const particles = static_cast<glm::vec4*>(staging_buffer_map.raw);
+
+        std::minstd_rand rng;
+        std::uniform_real_distribution<float> position{0.0f, 1.0f};
+        std::uniform_real_distribution<float> velocity{-0.01f, 0.01f};
+
+        for (uint32_t i = 0; i < num_particles; ++i)
+        {
+            particles[i] = {position(rng), position(rng),
+                            velocity(rng), velocity(rng)};
+        }
+    }
+
+    // The buffer is uploaded on the graphics queue and simulated on the
+    // compute queue, which may belong to a different family
+    particle_buffer = vkutil::BufferBuilder{*vulkan}
+        .set_size(size)
+        .set_usage(
+            vk::BufferUsageFlagBits::eStorageBuffer |
+            vk::BufferUsageFlagBits::eTransferDst)
+        .set_memory_properties(vk::MemoryPropertyFlagBits::eDeviceLocal)
+        .set_queue_family_indices(
+            {vulkan->graphics_queue_family_index(), vulkan->compute_queue_family_index()})
+        .build();
+
+    vkutil::copy_buffer(*vulkan, staging_buffer, particle_buffer, size);
+
+    compute_descriptor_set = vkutil::DescriptorSetBuilder{*vulkan}
+        .set_type(vk::DescriptorType::eStorageBuffer)
+        .set_stage_flags(vk::ShaderStageFlagBits::eCompute)
+        .set_buffer(particle_buffer, 0, size)
+        .set_layout_out(compute_descriptor_set_layout)
+        .build();
+}
+
+void ComputeScene::setup_render_pass()
+{
+    render_pass = vkutil::RenderPassBuilder(*vulkan)
+        .set_color_format(format)
+        .set_color_load_op(vk::AttachmentLoadOp::eClear)
+        .build();
+}
+
+void ComputeScene::setup_pipelines()
+{
+    auto const pipeline_layout_create_info = vk::PipelineLayoutCreateInfo{}
+        .setSetLayoutCount(1)
+        .setPSetLayouts(&descriptor_set_layout);
+    pipeline_layout = ManagedResource<vk::PipelineLayout>{
+        vulkan->device().createPipelineLayout(pipeline_layout_create_info),
+        [this] (auto const& pl) { vulkan->device().destroyPipelineLayout(pl); }};
+
+    pipeline = vkutil::PipelineBuilder(*vulkan)
+        .set_extent(extent)
+        .set_layout(pipeline_layout)
+        .set_render_pass(render_pass)
+        .set_vertex_shader(Util::read_data_file("shaders/vkcube.vert.spv"))
+        .set_fragment_shader(Util::read_data_file("shaders/vkcube.frag.spv"))
+        .set_vertex_input(mesh->binding_descriptions(), mesh->attribute_descriptions())
+        .build();
+
+    auto const compute_pipeline_layout_create_info = vk::PipelineLayoutCreateInfo{}
+        .setSetLayoutCount(1)
+        .setPSetLayouts(&compute_descriptor_set_layout);
+    compute_pipeline_layout = ManagedResource<vk::PipelineLayout>{
+        vulkan->device().createPipelineLayout(compute_pipeline_layout_create_info),
+        [this] (auto const& pl) { vulkan->device().destroyPipelineLayout(pl); }};
+
+    compute_pipeline = vkutil::ComputePipelineBuilder(*vulkan)
+        .set_layout(compute_pipeline_layout)
+        .set_compute_shader(Util::read_data_file("shaders/particles.comp.spv"))
+        .build();
+}
+
+void ComputeScene::setup_framebuffers(std::vector<VulkanImage> const& vulkan_images)
+{
+    for (auto const& vulkan_image : vulkan_images)
+    {
+        image_views.push_back(
+            vkutil::ImageViewBuilder{*vulkan}
+                .set_image(vulkan_image.image)
+                .set_format(vulkan_image.format)
+                .set_aspect_mask(vk::ImageAspectFlagBits::eColor)
+                .build());
+    }
+
+    for (auto const& image_view : image_views)
+    {
+        framebuffers.push_back(
+            vkutil::FramebufferBuilder{*vulkan}
+                .set_render_pass(render_pass)
+                .set_image_views({image_view})
+                .set_extent(extent)
+                .build());
+    }
+}
+
+void ComputeScene::setup_command_buffers()
+{
+    auto const command_buffer_allocate_info = vk::CommandBufferAllocateInfo{}
+        .setCommandPool(vulkan->command_pool())
+        .setCommandBufferCount(num_frame_slots() * framebuffers.size())
+        .setLevel(vk::CommandBufferLevel::ePrimary);
+
+    command_buffers = vulkan->device().allocateCommandBuffers(command_buffer_allocate_info);
+    auto const binding_offsets = mesh->vertex_data_binding_offsets();
+
+    for (size_t i = 0; i < command_buffers.size(); ++i)
+    {
+        // One command buffer for each frame slot and swapchain image
+        auto const slot = i / framebuffers.size();
+        auto const image_index = i % framebuffers.size();
+
+        command_buffers[i].begin(vk::CommandBufferBeginInfo{});
+        begin_gpu_queries(command_buffers[i], slot);
+
+        if (!async)
+            record_dispatches(command_buffers[i]);
+
+        vk::ClearValue const clear_color{
+            vk::ClearColorValue{std::array<float,4>{{0.2f, 0.2f, 0.2f, 1.0f}}}};
+
+        auto const render_pass_begin_info = vk::RenderPassBeginInfo{}
+            .setRenderPass(render_pass)
+            .setFramebuffer(framebuffers[image_index])
+            .setRenderArea({{0,0}, extent})
+            .setClearValueCount(1)
+            .setPClearValues(&clear_color);
+
+        command_buffers[i].beginRenderPass(render_pass_begin_info, vk::SubpassContents::eInline);
+
+        command_buffers[i].bindPipeline(vk::PipelineBindPoint::eGraphics, pipeline);
+        command_buffers[i].bindDescriptorSets(
+            vk::PipelineBindPoint::eGraphics, pipeline_layout, 0, descriptor_set.raw, {});
+        command_buffers[i].bindVertexBuffers(
+            0,
+            std::vector<vk::Buffer>{binding_offsets.size(), vertex_buffer.raw},
+            binding_offsets
+            );
+
+        for (uint32_t draw = 0; draw < num_draws; ++draw)
+            command_buffers[i].draw(mesh->num_vertices(), 1, 0, 0);
+
+        command_buffers[i].endRenderPass();
+        end_gpu_queries(command_buffers[i], slot);
+        command_buffers[i].end();
+    }
+
+    if (!async)
+        return;
+
+    compute_command_pool = vkutil::CommandPoolBuilder{*vulkan}
+        .set_queue_family_index(vulkan->compute_queue_family_index())
+        .build();
+
+    auto const compute_command_buffer_allocate_info = vk::CommandBufferAllocateInfo{}
+        .setCommandPool(compute_command_pool)
+        .setCommandBufferCount(num_frame_slots())
+        .setLevel(vk::CommandBufferLevel::ePrimary);
+
+    compute_command_buffers =
+        vulkan->device().allocateCommandBuffers(compute_command_buffer_allocate_info);
+
+    for (auto const& command_buffer : compute_command_buffers)
+    {
+        command_buffer.begin(vk::CommandBufferBeginInfo{});
+        record_dispatches(command_buffer);
+        command_buffer.end();
+
+        compute_semaphores.push_back(vkutil::SemaphoreBuilder{*vulkan}.build());
+    }
+}
+
+void ComputeScene::record_dispatches(vk::CommandBuffer const& command_buffer)
+{
+    // Each step updates the particles in place, so it must wait for the
+    // previous step, including the last one of the previous frame
+    auto const barrier = vk::MemoryBarrier{}
+        .setSrcAccessMask(vk::AccessFlagBits::eShaderWrite)
+        .setDstAccessMask(vk::AccessFlagBits::eShaderRead | vk::AccessFlagBits::eShaderWrite);
+
+    command_buffer.bindPipeline(vk::PipelineBindPoint::eCompute, compute_pipeline);
+    command_buffer.bindDescriptorSets(
+        vk::PipelineBindPoint::eCompute, compute_pipeline_layout, 0,
+        compute_descriptor_set.raw, {});
+
+    for (uint32_t i = 0; i < num_dispatches; ++i)
+    {
+        command_buffer.pipelineBarrier(
+            vk::PipelineStageFlagBits::eComputeShader,
+            vk::PipelineStageFlagBits::eComputeShader,
+            {}, barrier, {}, {});
+        command_buffer.dispatch(num_particles / workgroup_size, 1, 1);
+    }
+}
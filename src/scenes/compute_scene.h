@@ -0,0 +1,92 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "scene.h"
+#include "managed_resource.h"
+
+#include <memory>
+
+#include <vulkan/vulkan.hpp>
+
+class Mesh;
+
+// Renders a cube while simulating particles with a compute shader. In
+// "async" mode the simulation is submitted to a dedicated compute queue,
+// if available, and rendering waits for it with a semaphore, so that the
+// compute work of a frame can overlap with rendering of the previous
+// frames. In "serial" mode the simulation is recorded in the graphics
+// command buffer before rendering, which provides the baseline.
+class ComputeScene : public Scene
+{
+public:
+    ComputeScene();
+    ~ComputeScene();
+
+    void setup(VulkanState&, std::vector<VulkanImage> const&) override;
+    void teardown() override;
+
+    VulkanImage draw(VulkanImage const&) override;
+
+    std::vector<std::pair<std::string, double>> metrics() const override;
+
+private:
+    void setup_vertex_buffer();
+    void setup_uniform_buffer();
+    void setup_particle_buffer();
+    void setup_render_pass();
+    void setup_pipelines();
+    void setup_framebuffers(std::vector<VulkanImage> const&);
+    void setup_command_buffers();
+    void record_dispatches(vk::CommandBuffer const& command_buffer);
+
+    VulkanState* vulkan;
+    vk::Extent2D extent;
+    vk::Format format;
+    uint32_t num_particles;
+    uint32_t num_dispatches;
+    uint32_t num_draws;
+    bool async;
+    // Whether async work runs on a dedicated compute queue
+    bool uses_compute_queue;
+
+    std::unique_ptr<Mesh> mesh;
+    ManagedResource<vk::Buffer> vertex_buffer;
+    ManagedResource<vk::Buffer> uniform_buffer;
+    ManagedResource<vk::DescriptorSet> descriptor_set;
+    vk::DescriptorSetLayout descriptor_set_layout;
+    ManagedResource<vk::RenderPass> render_pass;
+    ManagedResource<vk::PipelineLayout> pipeline_layout;
+    ManagedResource<vk::Pipeline> pipeline;
+    std::vector<ManagedResource<vk::ImageView>> image_views;
+    std::vector<ManagedResource<vk::Framebuffer>> framebuffers;
+    std::vector<vk::CommandBuffer> command_buffers;
+
+    ManagedResource<vk::Buffer> particle_buffer;
+    ManagedResource<vk::DescriptorSet> compute_descriptor_set;
+    vk::DescriptorSetLayout compute_descriptor_set_layout;
+    ManagedResource<vk::PipelineLayout> compute_pipeline_layout;
+    ManagedResource<vk::Pipeline> compute_pipeline;
+    // Used only in async mode, one of each per frame slot
+    ManagedResource<vk::CommandPool> compute_command_pool;
+    std::vector<vk::CommandBuffer> compute_command_buffers;
+    std::vector<ManagedResource<vk::Semaphore>> compute_semaphores;
+};
@@ -72,7 +72,6 @@ private:
     std::vector<ManagedResource<vk::ImageView>> image_views;
     std::vector<ManagedResource<vk::Framebuffer>> framebuffers;
     std::vector<vk::CommandBuffer> command_buffers;
-    ManagedResource<vk::Semaphore> submit_semaphore;
 
     vk::DescriptorSetLayout descriptor_set_layout;
 
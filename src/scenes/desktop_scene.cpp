@@ -74,12 +74,14 @@ std::unique_ptr<Mesh> create_quad_mesh()
 class DesktopScene::RenderObject
 {
 public:
-    RenderObject(VulkanState& vulkan, std::string const& texture_file, size_t num_buffers)
+    RenderObject(VulkanState& vulkan, vkutil::UploadBatcher& upload_batcher,
+                 std::string const& texture_file, size_t num_buffers)
         : vulkan{vulkan}
     {
         texture = vkutil::TextureBuilder{vulkan}
             .set_file(texture_file)
             .set_filter(vk::Filter::eLinear)
+            .set_upload_batcher(upload_batcher)
             .build();
 
 
@@ -191,12 +193,21 @@ void DesktopScene::setup(
 
     mesh = create_quad_mesh();
 
+    setup_frame_slots(*vulkan);
+
     auto const texture_file =
         "textures/desktop-background-" +
         options_["background-resolution"].value +
         ".png";
 
-    background = std::make_unique<RenderObject>(*vulkan, texture_file, 1);
+    // All textures and the vertex buffer are uploaded with a single
+    // submission, after all render objects have been created
+    vkutil::UploadBatcher upload_batcher{*vulkan};
+
+    // Most of the cost of creating render objects is loading their textures
+    background = setup_timing_.timed("texture", [&] {
+        return std::make_unique<RenderObject>(*vulkan, upload_batcher, texture_file, 1);
+    });
     background->update_uniforms(0);
 
     auto const aspect = static_cast<float>(extent.width) / extent.height;
@@ -209,26 +220,27 @@ void DesktopScene::setup(
 
     for (auto i = 0u; i < windows.size(); ++i)
     {
-        windows[i] = std::make_unique<RenderObject>(*vulkan, "textures/desktop-window.png", vulkan_images.size());
+        windows[i] = setup_timing_.timed("texture", [&] {
+            return std::make_unique<RenderObject>(
+                *vulkan, upload_batcher, "textures/desktop-window.png", num_frame_slots());
+        });
         windows[i]->size = window_size;
         windows[i]->speed = {std::cos(0.1 + i * M_PI / 6.0) * 2.0 / 3,
                              std::sin(0.1 + i * M_PI / 6.0) * 2.0 / 3};
     }
 
-    setup_vertex_buffer();
+    setup_vertex_buffer(upload_batcher);
+    setup_timing_.timed("upload", [&] { upload_batcher.submit(); });
     setup_render_pass();
-    setup_pipeline();
+    setup_timing_.timed("pipeline", [this] { setup_pipeline(); });
     setup_framebuffers(vulkan_images);
     setup_command_buffers();
-
-    submit_semaphore = vkutil::SemaphoreBuilder{*vulkan}.build();
 }
 
 void DesktopScene::teardown()
 {
     vulkan->device().waitIdle();
 
-    submit_semaphore = {};
     vulkan->device().freeCommandBuffers(vulkan->command_pool(), command_buffers);
     framebuffers.clear();
     image_views.clear();
@@ -246,26 +258,19 @@ void DesktopScene::teardown()
 
 VulkanImage DesktopScene::draw(VulkanImage const& image)
 {
-    update_uniforms(image.index);
+    auto const slot = next_frame_slot();
+    auto const index = slot * framebuffers.size() + image.index;
 
-    vk::PipelineStageFlags const mask = vk::PipelineStageFlagBits::eColorAttachmentOutput;
-    auto const submit_info = vk::SubmitInfo{}
-        .setCommandBufferCount(1)
-        .setPCommandBuffers(&command_buffers[image.index])
-        .setWaitSemaphoreCount(image.semaphore ? 1 : 0)
-        .setPWaitSemaphores(&image.semaphore)
-        .setPWaitDstStageMask(&mask)
-        .setSignalSemaphoreCount(image.semaphore ? 1 : 0)
-        .setPSignalSemaphores(&submit_semaphore.raw);
+    update_uniforms(slot);
 
-    vulkan->graphics_queue().submit(submit_info, image.submit_fence);
+    collect_gpu_queries(slot);
 
-    return image.copy_with_semaphore(submit_semaphore);
+    return submit_frame(command_buffers[index], image);
 }
 
 void DesktopScene::update()
 {
-    auto const dt = (Util::get_timestamp_us() - last_update_time) / 1000000.0f;
+    auto const dt = animation_time_delta() / 1000000.0f;
 
     for (auto const& window : windows)
         window->update(dt);
@@ -273,27 +278,10 @@ void DesktopScene::update()
     Scene::update();
 }
 
-void DesktopScene::setup_vertex_buffer()
+void DesktopScene::setup_vertex_buffer(vkutil::UploadBatcher& upload_batcher)
 {
-    vk::DeviceMemory staging_buffer_memory;
-    vk::BufferUsageFlags staging_usage_flags =
-        vk::BufferUsageFlagBits::eVertexBuffer |
-        vk::BufferUsageFlagBits::eTransferSrc;
-
-    auto staging_buffer = vkutil::BufferBuilder{*vulkan}
-        .set_size(mesh->vertex_data_size())
-        .set_usage(staging_usage_flags)
-        .set_memory_properties(
-            vk::MemoryPropertyFlagBits::eHostVisible |
-            vk::MemoryPropertyFlagBits::eHostCoherent)
-        .set_memory_out(staging_buffer_memory)
-        .build();
-
-    {
-        auto const staging_buffer_map = vkutil::map_memory(
-            *vulkan, staging_buffer_memory, 0, mesh->vertex_data_size());
-        mesh->copy_vertex_data_to(staging_buffer_map);
-    }
+    std::vector<char> vertex_data(mesh->vertex_data_size());
+    mesh->copy_vertex_data_to(vertex_data.data());
 
     vertex_buffer = vkutil::BufferBuilder{*vulkan}
         .set_size(mesh->vertex_data_size())
@@ -303,7 +291,7 @@ void DesktopScene::setup_vertex_buffer()
         .set_memory_properties(vk::MemoryPropertyFlagBits::eDeviceLocal)
         .build();
 
-    vkutil::copy_buffer(*vulkan, staging_buffer, vertex_buffer, mesh->vertex_data_size());
+    upload_batcher.add_buffer(vertex_buffer, vertex_data.data(), vertex_data.size());
 }
 
 void DesktopScene::setup_render_pass()
@@ -365,7 +353,7 @@ void DesktopScene::setup_command_buffers()
 {
     auto const command_buffer_allocate_info = vk::CommandBufferAllocateInfo{}
         .setCommandPool(vulkan->command_pool())
-        .setCommandBufferCount(framebuffers.size())
+        .setCommandBufferCount(num_frame_slots() * framebuffers.size())
         .setLevel(vk::CommandBufferLevel::ePrimary);
 
     command_buffers = vulkan->device().allocateCommandBuffers(command_buffer_allocate_info);
@@ -373,14 +361,19 @@ void DesktopScene::setup_command_buffers()
 
     for (size_t i = 0; i < command_buffers.size(); ++i)
     {
+        // One command buffer for each frame slot and swapchain image
+        auto const slot = i / framebuffers.size();
+        auto const image_index = i % framebuffers.size();
+
         auto const begin_info = vk::CommandBufferBeginInfo{}
             .setFlags(vk::CommandBufferUsageFlagBits::eSimultaneousUse);
 
         command_buffers[i].begin(begin_info);
+        begin_gpu_queries(command_buffers[i], slot);
 
         auto const render_pass_begin_info = vk::RenderPassBeginInfo{}
             .setRenderPass(render_pass)
-            .setFramebuffer(framebuffers[i])
+            .setFramebuffer(framebuffers[image_index])
             .setRenderArea({{0,0}, extent});
 
         command_buffers[i].beginRenderPass(render_pass_begin_info, vk::SubpassContents::eInline);
@@ -404,12 +397,13 @@ void DesktopScene::setup_command_buffers()
         for (auto const& window : windows)
         {
             command_buffers[i].bindDescriptorSets(
-                vk::PipelineBindPoint::eGraphics, pipeline_layout, 0, window->descriptor_sets[i].raw, {});
+                vk::PipelineBindPoint::eGraphics, pipeline_layout, 0, window->descriptor_sets[slot].raw, {});
 
             command_buffers[i].draw(mesh->num_vertices(), 1, 0, 0);
         }
 
         command_buffers[i].endRenderPass();
+        end_gpu_queries(command_buffers[i], slot);
         command_buffers[i].end();
     }
 }
@@ -32,6 +32,7 @@
 #include <vulkan/vulkan.hpp>
 
 class Mesh;
+namespace vkutil { class UploadBatcher; }
 
 class DesktopScene : public Scene
 {
@@ -48,7 +49,7 @@ public:
 private:
     class RenderObject;
 
-    void setup_vertex_buffer();
+    void setup_vertex_buffer(vkutil::UploadBatcher& upload_batcher);
     void setup_render_pass();
     void setup_pipeline();
     void setup_framebuffers(std::vector<VulkanImage> const&);
@@ -71,5 +72,4 @@ private:
     std::vector<ManagedResource<vk::ImageView>> image_views;
     std::vector<ManagedResource<vk::Framebuffer>> framebuffers;
     std::vector<vk::CommandBuffer> command_buffers;
-    ManagedResource<vk::Semaphore> submit_semaphore;
 };
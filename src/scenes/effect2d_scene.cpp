@@ -98,25 +98,27 @@ void Effect2DScene::setup(
 
     mesh = create_quad_mesh();
 
-    setup_vertex_buffer();
+    // The vertex buffer and the texture are uploaded with a single submission
+    vkutil::UploadBatcher upload_batcher{*vulkan};
+
+    setup_frame_slots(*vulkan);
+    setup_vertex_buffer(upload_batcher);
     setup_uniform_buffer();
-    setup_texture();
+    setup_timing_.timed("texture", [&] { setup_texture(upload_batcher); });
+    setup_timing_.timed("upload", [&] { upload_batcher.submit(); });
     setup_shader_descriptor_set();
     setup_render_pass();
-    setup_pipeline();
+    setup_timing_.timed("pipeline", [this] { setup_pipeline(); });
     setup_framebuffers(vulkan_images);
     setup_command_buffers();
 
     update_uniforms();
-
-    submit_semaphore = vkutil::SemaphoreBuilder{*vulkan}.build();
 }
 
 void Effect2DScene::teardown()
 {
     vulkan->device().waitIdle();
 
-    submit_semaphore = {};
     vulkan->device().freeCommandBuffers(vulkan->command_pool(), command_buffers);
     framebuffers.clear();
     image_views.clear();
@@ -134,19 +136,12 @@ void Effect2DScene::teardown()
 
 VulkanImage Effect2DScene::draw(VulkanImage const& image)
 {
-    vk::PipelineStageFlags const mask = vk::PipelineStageFlagBits::eColorAttachmentOutput;
-    auto const submit_info = vk::SubmitInfo{}
-        .setCommandBufferCount(1)
-        .setPCommandBuffers(&command_buffers[image.index])
-        .setWaitSemaphoreCount(image.semaphore ? 1 : 0)
-        .setPWaitSemaphores(&image.semaphore)
-        .setPWaitDstStageMask(&mask)
-        .setSignalSemaphoreCount(image.semaphore ? 1 : 0)
-        .setPSignalSemaphores(&submit_semaphore.raw);
-
-    vulkan->graphics_queue().submit(submit_info, image.submit_fence);
-
-    return image.copy_with_semaphore(submit_semaphore);
+    auto const slot = next_frame_slot();
+    auto const index = slot * framebuffers.size() + image.index;
+
+    collect_gpu_queries(slot);
+
+    return submit_frame(command_buffers[index], image);
 }
 
 void Effect2DScene::update()
@@ -154,27 +149,10 @@ void Effect2DScene::update()
     Scene::update();
 }
 
-void Effect2DScene::setup_vertex_buffer()
+void Effect2DScene::setup_vertex_buffer(vkutil::UploadBatcher& upload_batcher)
 {
-    vk::DeviceMemory staging_buffer_memory;
-    vk::BufferUsageFlags staging_usage_flags =
-        vk::BufferUsageFlagBits::eVertexBuffer |
-        vk::BufferUsageFlagBits::eTransferSrc;
-
-    auto staging_buffer = vkutil::BufferBuilder{*vulkan}
-        .set_size(mesh->vertex_data_size())
-        .set_usage(staging_usage_flags)
-        .set_memory_properties(
-            vk::MemoryPropertyFlagBits::eHostVisible |
-            vk::MemoryPropertyFlagBits::eHostCoherent)
-        .set_memory_out(staging_buffer_memory)
-        .build();
-
-    {
-        auto const staging_buffer_map = vkutil::map_memory(
-            *vulkan, staging_buffer_memory, 0, mesh->vertex_data_size());
-        mesh->copy_vertex_data_to(staging_buffer_map);
-    }
+    std::vector<char> vertex_data(mesh->vertex_data_size());
+    mesh->copy_vertex_data_to(vertex_data.data());
 
     vertex_buffer = vkutil::BufferBuilder{*vulkan}
         .set_size(mesh->vertex_data_size())
@@ -184,7 +162,7 @@ void Effect2DScene::setup_vertex_buffer()
         .set_memory_properties(vk::MemoryPropertyFlagBits::eDeviceLocal)
         .build();
 
-    vkutil::copy_buffer(*vulkan, staging_buffer, vertex_buffer, mesh->vertex_data_size());
+    upload_batcher.add_buffer(vertex_buffer, vertex_data.data(), vertex_data.size());
 }
 
 void Effect2DScene::setup_uniform_buffer()
@@ -202,7 +180,7 @@ void Effect2DScene::setup_uniform_buffer()
         *vulkan, uniform_buffer_memory, 0, sizeof(Uniforms));
 }
 
-void Effect2DScene::setup_texture()
+void Effect2DScene::setup_texture(vkutil::UploadBatcher& upload_batcher)
 {
     auto const texture_file =
         "textures/desktop-background-" +
@@ -212,6 +190,7 @@ void Effect2DScene::setup_texture()
     texture = vkutil::TextureBuilder{*vulkan}
         .set_file(texture_file)
         .set_filter(vk::Filter::eNearest)
+        .set_upload_batcher(upload_batcher)
         .build();
 }
 
@@ -287,7 +266,7 @@ void Effect2DScene::setup_command_buffers()
 {
     auto const command_buffer_allocate_info = vk::CommandBufferAllocateInfo{}
         .setCommandPool(vulkan->command_pool())
-        .setCommandBufferCount(framebuffers.size())
+        .setCommandBufferCount(num_frame_slots() * framebuffers.size())
         .setLevel(vk::CommandBufferLevel::ePrimary);
 
     command_buffers = vulkan->device().allocateCommandBuffers(command_buffer_allocate_info);
@@ -295,14 +274,19 @@ void Effect2DScene::setup_command_buffers()
 
     for (size_t i = 0; i < command_buffers.size(); ++i)
     {
+        // One command buffer for each frame slot and swapchain image
+        auto const slot = i / framebuffers.size();
+        auto const image_index = i % framebuffers.size();
+
         auto const begin_info = vk::CommandBufferBeginInfo{}
             .setFlags(vk::CommandBufferUsageFlagBits::eSimultaneousUse);
 
         command_buffers[i].begin(begin_info);
+        begin_gpu_queries(command_buffers[i], slot);
 
         auto const render_pass_begin_info = vk::RenderPassBeginInfo{}
             .setRenderPass(render_pass)
-            .setFramebuffer(framebuffers[i])
+            .setFramebuffer(framebuffers[image_index])
             .setRenderArea({{0,0}, extent});
 
         command_buffers[i].beginRenderPass(render_pass_begin_info, vk::SubpassContents::eInline);
@@ -320,6 +304,7 @@ void Effect2DScene::setup_command_buffers()
         command_buffers[i].draw(mesh->num_vertices(), 1, 0, 0);
 
         command_buffers[i].endRenderPass();
+        end_gpu_queries(command_buffers[i], slot);
         command_buffers[i].end();
     }
 }
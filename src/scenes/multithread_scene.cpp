@@ -0,0 +1,389 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "multithread_scene.h"
+
+#include "mesh.h"
+#include "model.h"
+#include "util.h"
+#include "trace.h"
+#include "worker_pool.h"
+#include "vulkan_state.h"
+#include "vulkan_image.h"
+#include "vkutil/vkutil.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/matrix_inverse.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+
+struct Uniforms
+{
+    glm::mat4 modelview;
+    glm::mat4 modelviewprojection;
+    glm::mat4 normal;
+};
+
+}
+
+MultithreadScene::MultithreadScene() : Scene{"multithread"}
+{
+    options_["threads"] = SceneOption("threads", "1",
+                                      "The number of threads recording command buffers");
+    options_["draws"] = SceneOption("draws", "8192",
+                                    "The number of draws recorded in each frame");
+}
+
+MultithreadScene::~MultithreadScene() = default;
+
+void MultithreadScene::setup(
+    VulkanState& vulkan_,
+    std::vector<VulkanImage> const& vulkan_images)
+{
+    Scene::setup(vulkan_, vulkan_images);
+
+    vulkan = &vulkan_;
+    extent = vulkan_images[0].extent;
+    format = vulkan_images[0].format;
+
+    auto const num_threads =
+        std::max(1u, Util::from_string<unsigned int>(options_["threads"].value));
+    num_draws = std::max(1u, Util::from_string<unsigned int>(options_["draws"].value));
+    grid_size = std::ceil(std::sqrt(num_draws));
+
+    auto const aspect = static_cast<float>(extent.height) / extent.width;
+    projection = glm::frustum(-2.8f, 2.8f, -2.8f * aspect, 2.8f * aspect, 6.0f, 10.0f);
+
+    // Each draw uses its own part of the uniform buffer through a dynamic
+    // offset, which must be suitably aligned
+    auto const alignment =
+        vulkan->physical_device().getProperties().limits.minUniformBufferOffsetAlignment;
+    uniform_stride = (sizeof(Uniforms) + alignment - 1) / alignment * alignment;
+
+    mesh = setup_timing_.timed("model", [] {
+        return Model{"kmscube.ply"}.to_mesh(
+            ModelAttribMap{}
+                .with_position(vk::Format::eR32G32B32Sfloat)
+                .with_color(vk::Format::eR32G32B32Sfloat)
+                .with_normal(vk::Format::eR32G32B32Sfloat));
+    });
+
+    worker_pool = std::make_unique<WorkerPool>(num_threads);
+
+    setup_vertex_buffer();
+    setup_frame_slots(*vulkan);
+    setup_frame_resources(num_frame_slots());
+    setup_render_pass();
+    setup_timing_.timed("pipeline", [this] { setup_pipeline(); });
+    setup_framebuffers(vulkan_images);
+
+    rotation = 0.0f;
+}
+
+void MultithreadScene::teardown()
+{
+    vulkan->device().waitIdle();
+
+    // Destroying the command pools also frees their command buffers
+    frames.clear();
+    framebuffers.clear();
+    image_views.clear();
+    pipeline = {};
+    pipeline_layout = {};
+    render_pass = {};
+    vertex_buffer = {};
+    worker_pool.reset();
+
+    Scene::teardown();
+}
+
+void MultithreadScene::start()
+{
+    record_time_stats.reset();
+
+    Scene::start();
+}
+
+VulkanImage MultithreadScene::draw(VulkanImage const& image)
+{
+    auto const slot = next_frame_slot();
+    auto& frame = frames[slot];
+    auto const framebuffer = framebuffers[image.index].raw;
+
+    collect_gpu_queries(slot);
+
+    auto const record_start = Util::get_timestamp_us();
+
+    worker_pool->run(
+        [&] (size_t thread)
+        {
+            record_secondary_command_buffer(frame, framebuffer, thread);
+        });
+
+    if (!is_warming_up())
+        record_time_stats.add(Util::get_timestamp_us() - record_start);
+
+    record_primary_command_buffer(frame, framebuffer, slot);
+
+    return submit_frame(frame.primary_command_buffer, image);
+}
+
+void MultithreadScene::update()
+{
+    rotation = animation_time() / 5000.0;
+
+    Scene::update();
+}
+
+std::vector<std::pair<std::string, double>> MultithreadScene::metrics() const
+{
+    return {{"record_time_ms", record_time_stats.mean() / 1000.0}};
+}
+
+void MultithreadScene::setup_vertex_buffer()
+{
+    vk::DeviceMemory vertex_buffer_memory;
+
+    vertex_buffer = vkutil::BufferBuilder{*vulkan}
+        .set_size(mesh->vertex_data_size())
+        .set_usage(vk::BufferUsageFlagBits::eVertexBuffer)
+        .set_memory_properties(
+            vk::MemoryPropertyFlagBits::eHostVisible |
+            vk::MemoryPropertyFlagBits::eHostCoherent)
+        .set_memory_out(vertex_buffer_memory)
+        .build();
+
+    auto const vertex_buffer_map = vkutil::map_memory(
+        *vulkan, vertex_buffer_memory, 0, mesh->vertex_data_size());
+    mesh->copy_vertex_data_to(vertex_buffer_map);
+
+    binding_offsets = mesh->vertex_data_binding_offsets();
+}
+
+void MultithreadScene::setup_frame_resources(uint32_t num_slots)
+{
+    auto const uniform_buffer_size = num_draws * uniform_stride;
+
+    frames.resize(num_slots);
+
+    for (auto& frame : frames)
+    {
+        // Pools are reset as a whole every frame, instead of resetting
+        // individual command buffers
+        frame.primary_command_pool = vkutil::CommandPoolBuilder{*vulkan}
+            .set_flags(vk::CommandPoolCreateFlagBits::eTransient)
+            .build();
+
+        frame.primary_command_buffer = vulkan->device().allocateCommandBuffers(
+            vk::CommandBufferAllocateInfo{}
+                .setCommandPool(frame.primary_command_pool)
+                .setCommandBufferCount(1)
+                .setLevel(vk::CommandBufferLevel::ePrimary))[0];
+
+        for (size_t i = 0; i < worker_pool->num_workers(); ++i)
+        {
+            frame.thread_command_pools.push_back(
+                vkutil::CommandPoolBuilder{*vulkan}
+                    .set_flags(vk::CommandPoolCreateFlagBits::eTransient)
+                    .build());
+
+            frame.secondary_command_buffers.push_back(
+                vulkan->device().allocateCommandBuffers(
+                    vk::CommandBufferAllocateInfo{}
+                        .setCommandPool(frame.thread_command_pools.back())
+                        .setCommandBufferCount(1)
+                        .setLevel(vk::CommandBufferLevel::eSecondary))[0]);
+        }
+
+        vk::DeviceMemory uniform_buffer_memory;
+
+        frame.uniform_buffer = vkutil::BufferBuilder{*vulkan}
+            .set_size(uniform_buffer_size)
+            .set_usage(vk::BufferUsageFlagBits::eUniformBuffer)
+            .set_memory_properties(
+                vk::MemoryPropertyFlagBits::eHostVisible |
+                vk::MemoryPropertyFlagBits::eHostCoherent)
+            .set_memory_out(uniform_buffer_memory)
+            .build();
+
+        frame.uniform_buffer_map = vkutil::map_memory(
+            *vulkan, uniform_buffer_memory, 0, uniform_buffer_size);
+
+        frame.descriptor_set = vkutil::DescriptorSetBuilder{*vulkan}
+            .set_type(vk::DescriptorType::eUniformBufferDynamic)
+            .set_stage_flags(vk::ShaderStageFlagBits::eVertex)
+            .set_buffer(frame.uniform_buffer, 0, sizeof(Uniforms))
+            .set_layout_out(descriptor_set_layout)
+            .build();
+    }
+}
+
+void MultithreadScene::setup_render_pass()
+{
+    render_pass = vkutil::RenderPassBuilder(*vulkan)
+        .set_color_format(format)
+        .set_color_load_op(vk::AttachmentLoadOp::eClear)
+        .build();
+}
+
+void MultithreadScene::setup_pipeline()
+{
+    auto const pipeline_layout_create_info = vk::PipelineLayoutCreateInfo{}
+        .setSetLayoutCount(1)
+        .setPSetLayouts(&descriptor_set_layout);
+    pipeline_layout = ManagedResource<vk::PipelineLayout>{
+        vulkan->device().createPipelineLayout(pipeline_layout_create_info),
+        [this] (auto const& pl) { vulkan->device().destroyPipelineLayout(pl); }};
+
+    pipeline = vkutil::PipelineBuilder(*vulkan)
+        .set_extent(extent)
+        .set_layout(pipeline_layout)
+        .set_render_pass(render_pass)
+        .set_vertex_shader(Util::read_data_file("shaders/vkcube.vert.spv"))
+        .set_fragment_shader(Util::read_data_file("shaders/vkcube.frag.spv"))
+        .set_vertex_input(mesh->binding_descriptions(), mesh->attribute_descriptions())
+        .build();
+}
+
+void MultithreadScene::setup_framebuffers(std::vector<VulkanImage> const& vulkan_images)
+{
+    for (auto const& vulkan_image : vulkan_images)
+    {
+        image_views.push_back(
+            vkutil::ImageViewBuilder{*vulkan}
+                .set_image(vulkan_image.image)
+                .set_format(vulkan_image.format)
+                .set_aspect_mask(vk::ImageAspectFlagBits::eColor)
+                .build());
+    }
+
+    for (auto const& image_view : image_views)
+    {
+        framebuffers.push_back(
+            vkutil::FramebufferBuilder{*vulkan}
+                .set_render_pass(render_pass)
+                .set_image_views({image_view})
+                .set_extent(extent)
+                .build());
+    }
+}
+
+void MultithreadScene::record_secondary_command_buffer(
+    FrameResources& frame, vk::Framebuffer framebuffer, size_t thread)
+{
+    Trace::Scope const trace{"record_secondary"};
+
+    auto const num_threads = worker_pool->num_workers();
+    uint32_t const first_draw = thread * num_draws / num_threads;
+    uint32_t const end_draw = (thread + 1) * num_draws / num_threads;
+
+    vulkan->device().resetCommandPool(frame.thread_command_pools[thread], {});
+
+    auto const inheritance_info = vk::CommandBufferInheritanceInfo{}
+        .setRenderPass(render_pass)
+        .setSubpass(0)
+        .setFramebuffer(framebuffer);
+
+    auto const begin_info = vk::CommandBufferBeginInfo{}
+        .setFlags(vk::CommandBufferUsageFlagBits::eOneTimeSubmit |
+                  vk::CommandBufferUsageFlagBits::eRenderPassContinue)
+        .setPInheritanceInfo(&inheritance_info);
+
+    auto& command_buffer = frame.secondary_command_buffers[thread];
+    auto const uniforms = static_cast<char*>(frame.uniform_buffer_map.raw);
+
+    command_buffer.begin(begin_info);
+    command_buffer.bindPipeline(vk::PipelineBindPoint::eGraphics, pipeline);
+    command_buffer.bindVertexBuffers(
+        0,
+        std::vector<vk::Buffer>{binding_offsets.size(), vertex_buffer.raw},
+        binding_offsets);
+
+    for (auto draw = first_draw; draw < end_draw; ++draw)
+    {
+        uint32_t const offset = draw * uniform_stride;
+
+        update_uniforms(uniforms + offset, draw);
+
+        command_buffer.bindDescriptorSets(
+            vk::PipelineBindPoint::eGraphics, pipeline_layout, 0,
+            frame.descriptor_set.raw, offset);
+        command_buffer.draw(mesh->num_vertices(), 1, 0, 0);
+    }
+
+    command_buffer.end();
+}
+
+void MultithreadScene::record_primary_command_buffer(
+    FrameResources& frame, vk::Framebuffer framebuffer, uint32_t slot)
+{
+    vulkan->device().resetCommandPool(frame.primary_command_pool, {});
+
+    auto const begin_info = vk::CommandBufferBeginInfo{}
+        .setFlags(vk::CommandBufferUsageFlagBits::eOneTimeSubmit);
+
+    auto& command_buffer = frame.primary_command_buffer;
+
+    command_buffer.begin(begin_info);
+    begin_gpu_queries(command_buffer, slot);
+
+    vk::ClearValue const clear_color{
+        vk::ClearColorValue{std::array<float,4>{{0.2f, 0.2f, 0.2f, 1.0f}}}};
+
+    auto const render_pass_begin_info = vk::RenderPassBeginInfo{}
+        .setRenderPass(render_pass)
+        .setFramebuffer(framebuffer)
+        .setRenderArea({{0,0}, extent})
+        .setClearValueCount(1)
+        .setPClearValues(&clear_color);
+
+    command_buffer.beginRenderPass(
+        render_pass_begin_info, vk::SubpassContents::eSecondaryCommandBuffers);
+    command_buffer.executeCommands(frame.secondary_command_buffers);
+    command_buffer.endRenderPass();
+
+    end_gpu_queries(command_buffer, slot);
+    command_buffer.end();
+}
+
+void MultithreadScene::update_uniforms(void* uniforms, uint32_t draw) const
+{
+    // Lay out the cubes in a grid covering the view
+    auto const cell_size = 7.0f / grid_size;
+    auto const x = -3.5f + cell_size * (draw % grid_size + 0.5f);
+    auto const y = -3.5f + cell_size * (draw / grid_size + 0.5f);
+    auto const angle = rotation + 10.0f * draw;
+
+    Uniforms ubo;
+
+    ubo.modelview = glm::translate(glm::mat4(1.0f), glm::vec3(x, y, -8.0f));
+    ubo.modelview = glm::scale(ubo.modelview, glm::vec3(0.35f * cell_size));
+    ubo.modelview = glm::rotate(ubo.modelview, glm::radians(angle), {1.0f, 0.0f, 0.0f});
+    ubo.modelview = glm::rotate(ubo.modelview, glm::radians(angle), {0.0f, 1.0f, 0.0f});
+
+    ubo.modelviewprojection = projection * ubo.modelview;
+    ubo.normal = glm::inverseTranspose(ubo.modelview);
+
+    memcpy(uniforms, &ubo, sizeof(ubo));
+}
@@ -0,0 +1,103 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "scene.h"
+#include "managed_resource.h"
+#include "running_stats.h"
+
+#include <memory>
+
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#include <glm/glm.hpp>
+#include <vulkan/vulkan.hpp>
+
+class Mesh;
+class WorkerPool;
+
+// Re-records thousands of draws every frame into secondary command buffers,
+// in parallel on a number of threads each with its own command pools, and
+// executes them from a primary command buffer.
+class MultithreadScene : public Scene
+{
+public:
+    MultithreadScene();
+    ~MultithreadScene();
+
+    void setup(VulkanState&, std::vector<VulkanImage> const&) override;
+    void teardown() override;
+
+    void start() override;
+    VulkanImage draw(VulkanImage const&) override;
+    void update() override;
+
+    std::vector<std::pair<std::string, double>> metrics() const override;
+
+private:
+    struct FrameResources
+    {
+        ManagedResource<vk::CommandPool> primary_command_pool;
+        vk::CommandBuffer primary_command_buffer;
+        // One pool and secondary command buffer per thread
+        std::vector<ManagedResource<vk::CommandPool>> thread_command_pools;
+        std::vector<vk::CommandBuffer> secondary_command_buffers;
+        ManagedResource<vk::Buffer> uniform_buffer;
+        ManagedResource<void*> uniform_buffer_map;
+        ManagedResource<vk::DescriptorSet> descriptor_set;
+    };
+
+    void setup_vertex_buffer();
+    void setup_frame_resources(uint32_t num_slots);
+    void setup_render_pass();
+    void setup_pipeline();
+    void setup_framebuffers(std::vector<VulkanImage> const&);
+    void record_secondary_command_buffer(
+        FrameResources& frame, vk::Framebuffer framebuffer, size_t thread);
+    void record_primary_command_buffer(
+        FrameResources& frame, vk::Framebuffer framebuffer, uint32_t slot);
+    void update_uniforms(void* uniforms, uint32_t draw) const;
+
+    VulkanState* vulkan;
+    vk::Extent2D extent;
+    vk::Format format;
+    glm::mat4 projection;
+    uint32_t num_draws;
+    uint32_t grid_size;
+    vk::DeviceSize uniform_stride;
+
+    std::unique_ptr<Mesh> mesh;
+    std::unique_ptr<WorkerPool> worker_pool;
+
+    ManagedResource<vk::Buffer> vertex_buffer;
+    std::vector<vk::DeviceSize> binding_offsets;
+    ManagedResource<vk::RenderPass> render_pass;
+    ManagedResource<vk::PipelineLayout> pipeline_layout;
+    ManagedResource<vk::Pipeline> pipeline;
+    std::vector<ManagedResource<vk::ImageView>> image_views;
+    std::vector<ManagedResource<vk::Framebuffer>> framebuffers;
+    std::vector<FrameResources> frames;
+
+    vk::DescriptorSetLayout descriptor_set_layout;
+
+    float rotation;
+    // Wall time in microseconds to record all secondary command buffers
+    RunningStats record_time_stats;
+};
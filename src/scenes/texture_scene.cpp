@@ -68,11 +68,13 @@ void TextureScene::setup(
     depth_format = vk::Format::eD32Sfloat;
     aspect = static_cast<float>(extent.height) / extent.width;
 
-    mesh = Model{"cube.3ds"}.to_mesh(
-        ModelAttribMap{}
-            .with_position(vk::Format::eR32G32B32Sfloat)
-            .with_normal(vk::Format::eR32G32B32Sfloat)
-            .with_texcoord(vk::Format::eR32G32Sfloat));
+    mesh = setup_timing_.timed("model", [] {
+        return Model{"cube.3ds"}.to_mesh(
+            ModelAttribMap{}
+                .with_position(vk::Format::eR32G32B32Sfloat)
+                .with_normal(vk::Format::eR32G32B32Sfloat)
+                .with_texcoord(vk::Format::eR32G32Sfloat));
+    });
 
     mesh->set_interleave(true);
 
@@ -86,17 +88,21 @@ void TextureScene::setup(
     auto const fovy = 2.0f * atanf(radius / (2.0f + radius));
     projection = glm::perspective(fovy, aspect, 2.0f, 2.0f + diameter);
 
-    setup_vertex_buffer();
-    setup_uniform_buffer(vulkan_images.size());
-    setup_texture();
+    // The vertex buffer and the texture are uploaded with a single submission
+    vkutil::UploadBatcher upload_batcher{*vulkan};
+
+    setup_vertex_buffer(upload_batcher);
+    setup_frame_slots(*vulkan);
+    setup_uniform_buffer(num_frame_slots());
+    setup_timing_.timed("texture", [&] { setup_texture(upload_batcher); });
+    setup_timing_.timed("upload", [&] { upload_batcher.submit(); });
     setup_shader_descriptor_set();
     setup_render_pass();
-    setup_pipeline();
+    setup_timing_.timed("pipeline", [this] { setup_pipeline(); });
     setup_depth_image();
     setup_framebuffers(vulkan_images);
     setup_command_buffers();
 
-    submit_semaphore = vkutil::SemaphoreBuilder{*vulkan}.build();
     rotation = 0.0f;
 }
 
@@ -104,7 +110,6 @@ void TextureScene::teardown()
 {
     vulkan->device().waitIdle();
 
-    submit_semaphore = {};
     vulkan->device().freeCommandBuffers(vulkan->command_pool(), command_buffers);
     framebuffers.clear();
     image_views.clear();
@@ -124,53 +129,29 @@ void TextureScene::teardown()
 
 VulkanImage TextureScene::draw(VulkanImage const& image)
 {
-    update_uniforms(image.index);
+    auto const slot = next_frame_slot();
+    auto const index = slot * framebuffers.size() + image.index;
 
-    vk::PipelineStageFlags const mask = vk::PipelineStageFlagBits::eColorAttachmentOutput;
-    auto const submit_info = vk::SubmitInfo{}
-        .setCommandBufferCount(1)
-        .setPCommandBuffers(&command_buffers[image.index])
-        .setWaitSemaphoreCount(image.semaphore ? 1 : 0)
-        .setPWaitSemaphores(&image.semaphore)
-        .setPWaitDstStageMask(&mask)
-        .setSignalSemaphoreCount(image.semaphore ? 1 : 0)
-        .setPSignalSemaphores(&submit_semaphore.raw);
+    update_uniforms(slot);
 
-    vulkan->graphics_queue().submit(submit_info, image.submit_fence);
+    collect_gpu_queries(slot);
 
-    return image.copy_with_semaphore(submit_semaphore);
+    return submit_frame(command_buffers[index], image);
 }
 
 void TextureScene::update()
 {
-    auto const t = (Util::get_timestamp_us() - start_time) / 1000000.0f;
+    auto const t = animation_time() / 1000000.0f;
 
     rotation = 36.0f * t;
 
     Scene::update();
 }
 
-void TextureScene::setup_vertex_buffer()
+void TextureScene::setup_vertex_buffer(vkutil::UploadBatcher& upload_batcher)
 {
-    vk::DeviceMemory staging_buffer_memory;
-    vk::BufferUsageFlags staging_usage_flags =
-        vk::BufferUsageFlagBits::eVertexBuffer |
-        vk::BufferUsageFlagBits::eTransferSrc;
-
-    auto staging_buffer = vkutil::BufferBuilder{*vulkan}
-        .set_size(mesh->vertex_data_size())
-        .set_usage(staging_usage_flags)
-        .set_memory_properties(
-            vk::MemoryPropertyFlagBits::eHostVisible |
-            vk::MemoryPropertyFlagBits::eHostCoherent)
-        .set_memory_out(staging_buffer_memory)
-        .build();
-
-    {
-        auto const staging_buffer_map = vkutil::map_memory(
-            *vulkan, staging_buffer_memory, 0, mesh->vertex_data_size());
-        mesh->copy_vertex_data_to(staging_buffer_map);
-    }
+    std::vector<char> vertex_data(mesh->vertex_data_size());
+    mesh->copy_vertex_data_to(vertex_data.data());
 
     vertex_buffer = vkutil::BufferBuilder{*vulkan}
         .set_size(mesh->vertex_data_size())
@@ -180,7 +161,7 @@ void TextureScene::setup_vertex_buffer()
         .set_memory_properties(vk::MemoryPropertyFlagBits::eDeviceLocal)
         .build();
 
-    vkutil::copy_buffer(*vulkan, staging_buffer, vertex_buffer, mesh->vertex_data_size());
+    upload_batcher.add_buffer(vertex_buffer, vertex_data.data(), vertex_data.size());
 }
 
 void TextureScene::setup_uniform_buffer(size_t num_buffers)
@@ -205,7 +186,7 @@ void TextureScene::setup_uniform_buffer(size_t num_buffers)
     }
 }
 
-void TextureScene::setup_texture()
+void TextureScene::setup_texture(vkutil::UploadBatcher& upload_batcher)
 {
     auto const& filter = options_["texture-filter"].value;
     auto const anisotropy = std::stof(options_["anisotropy"].value);
@@ -220,6 +201,7 @@ void TextureScene::setup_texture()
         .set_file("textures/crate-base.jpg")
         .set_filter(vk_filter)
         .set_anisotropy(anisotropy)
+        .set_upload_batcher(upload_batcher)
         .build();
 }
 
@@ -322,7 +304,7 @@ void TextureScene::setup_command_buffers()
 {
     auto const command_buffer_allocate_info = vk::CommandBufferAllocateInfo{}
         .setCommandPool(vulkan->command_pool())
-        .setCommandBufferCount(framebuffers.size())
+        .setCommandBufferCount(num_frame_slots() * framebuffers.size())
         .setLevel(vk::CommandBufferLevel::ePrimary);
 
     command_buffers = vulkan->device().allocateCommandBuffers(command_buffer_allocate_info);
@@ -330,10 +312,15 @@ void TextureScene::setup_command_buffers()
 
     for (size_t i = 0; i < command_buffers.size(); ++i)
     {
+        // One command buffer for each frame slot and swapchain image
+        auto const slot = i / framebuffers.size();
+        auto const image_index = i % framebuffers.size();
+
         auto const begin_info = vk::CommandBufferBeginInfo{}
             .setFlags(vk::CommandBufferUsageFlagBits::eSimultaneousUse);
 
         command_buffers[i].begin(begin_info);
+        begin_gpu_queries(command_buffers[i], slot);
 
         std::array<vk::ClearValue, 2> clear_values{{
             vk::ClearColorValue{std::array<float,4>{{0.0f, 0.0f, 0.0f, 1.0f}}},
@@ -341,7 +328,7 @@ void TextureScene::setup_command_buffers()
 
         auto const render_pass_begin_info = vk::RenderPassBeginInfo{}
             .setRenderPass(render_pass)
-            .setFramebuffer(framebuffers[i])
+            .setFramebuffer(framebuffers[image_index])
             .setRenderArea({{0,0}, extent})
             .setClearValueCount(clear_values.size())
             .setPClearValues(clear_values.data());
@@ -350,7 +337,7 @@ void TextureScene::setup_command_buffers()
 
         command_buffers[i].bindPipeline(vk::PipelineBindPoint::eGraphics, pipeline);
         command_buffers[i].bindDescriptorSets(
-            vk::PipelineBindPoint::eGraphics, pipeline_layout, 0, descriptor_sets[i].raw, {});
+            vk::PipelineBindPoint::eGraphics, pipeline_layout, 0, descriptor_sets[slot].raw, {});
         command_buffers[i].bindVertexBuffers(
             0,
             std::vector<vk::Buffer>{binding_offsets.size(), vertex_buffer.raw},
@@ -360,6 +347,7 @@ void TextureScene::setup_command_buffers()
         command_buffers[i].draw(mesh->num_vertices(), 1, 0, 0);
 
         command_buffers[i].endRenderPass();
+        end_gpu_queries(command_buffers[i], slot);
         command_buffers[i].end();
     }
 }
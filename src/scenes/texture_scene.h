@@ -33,6 +33,7 @@
 #include <vulkan/vulkan.hpp>
 
 class Mesh;
+namespace vkutil { class UploadBatcher; }
 
 class TextureScene : public Scene
 {
@@ -47,9 +48,9 @@ public:
     void update() override;
 
 private:
-    void setup_vertex_buffer();
+    void setup_vertex_buffer(vkutil::UploadBatcher& upload_batcher);
     void setup_uniform_buffer(size_t num_buffers);
-    void setup_texture();
+    void setup_texture(vkutil::UploadBatcher& upload_batcher);
     void setup_shader_descriptor_set();
     void setup_render_pass();
     void setup_pipeline();
@@ -82,7 +83,6 @@ private:
     std::vector<ManagedResource<vk::ImageView>> image_views;
     std::vector<ManagedResource<vk::Framebuffer>> framebuffers;
     std::vector<vk::CommandBuffer> command_buffers;
-    ManagedResource<vk::Semaphore> submit_semaphore;
 
     vk::DescriptorSetLayout descriptor_set_layout;
 
@@ -69,10 +69,12 @@ void VertexScene::setup(
     depth_format = vk::Format::eD32Sfloat;
     aspect = static_cast<float>(extent.height) / extent.width;
 
-    mesh = Model{"horse.3ds"}.to_mesh(
-        ModelAttribMap{}
-            .with_position(vk::Format::eR32G32B32Sfloat)
-            .with_normal(vk::Format::eR32G32B32Sfloat));
+    mesh = setup_timing_.timed("model", [] {
+        return Model{"horse.3ds"}.to_mesh(
+            ModelAttribMap{}
+                .with_position(vk::Format::eR32G32B32Sfloat)
+                .with_normal(vk::Format::eR32G32B32Sfloat));
+    });
 
     mesh->set_interleave(options_["interleave"].value == "true");
 
@@ -87,15 +89,15 @@ void VertexScene::setup(
     projection = glm::perspective(fovy, aspect, 2.0f, 2.0f + diameter);
 
     setup_vertex_buffer();
-    setup_uniform_buffers(vulkan_images.size());
+    setup_frame_slots(*vulkan);
+    setup_uniform_buffers(num_frame_slots());
     setup_uniform_descriptor_sets();
     setup_render_pass();
-    setup_pipeline();
+    setup_timing_.timed("pipeline", [this] { setup_pipeline(); });
     setup_depth_image();
     setup_framebuffers(vulkan_images);
     setup_command_buffers();
 
-    submit_semaphore = vkutil::SemaphoreBuilder{*vulkan}.build();
     rotation = 0.0;
 }
 
@@ -103,7 +105,6 @@ void VertexScene::teardown()
 {
     vulkan->device().waitIdle();
 
-    submit_semaphore = {};
     vulkan->device().freeCommandBuffers(vulkan->command_pool(), command_buffers);
     framebuffers.clear();
     image_views.clear();
@@ -122,26 +123,19 @@ void VertexScene::teardown()
 
 VulkanImage VertexScene::draw(VulkanImage const& image)
 {
-    update_uniforms(image.index);
+    auto const slot = next_frame_slot();
+    auto const index = slot * framebuffers.size() + image.index;
 
-    vk::PipelineStageFlags const mask = vk::PipelineStageFlagBits::eColorAttachmentOutput;
-    auto const submit_info = vk::SubmitInfo{}
-        .setCommandBufferCount(1)
-        .setPCommandBuffers(&command_buffers[image.index])
-        .setWaitSemaphoreCount(image.semaphore ? 1 : 0)
-        .setPWaitSemaphores(&image.semaphore)
-        .setPWaitDstStageMask(&mask)
-        .setSignalSemaphoreCount(image.semaphore ? 1 : 0)
-        .setPSignalSemaphores(&submit_semaphore.raw);
+    update_uniforms(slot);
 
-    vulkan->graphics_queue().submit(submit_info, image.submit_fence);
+    collect_gpu_queries(slot);
 
-    return image.copy_with_semaphore(submit_semaphore);
+    return submit_frame(command_buffers[index], image);
 }
 
 void VertexScene::update()
 {
-    auto const t = (Util::get_timestamp_us() - start_time) / 1000000.0f;
+    auto const t = animation_time() / 1000000.0f;
 
     rotation = 36.0f * t;
 
@@ -309,7 +303,7 @@ void VertexScene::setup_command_buffers()
 {
     auto const command_buffer_allocate_info = vk::CommandBufferAllocateInfo{}
         .setCommandPool(vulkan->command_pool())
-        .setCommandBufferCount(framebuffers.size())
+        .setCommandBufferCount(num_frame_slots() * framebuffers.size())
         .setLevel(vk::CommandBufferLevel::ePrimary);
 
     command_buffers = vulkan->device().allocateCommandBuffers(command_buffer_allocate_info);
@@ -317,10 +311,15 @@ void VertexScene::setup_command_buffers()
 
     for (size_t i = 0; i < command_buffers.size(); ++i)
     {
+        // One command buffer for each frame slot and swapchain image
+        auto const slot = i / framebuffers.size();
+        auto const image_index = i % framebuffers.size();
+
         auto const begin_info = vk::CommandBufferBeginInfo{}
             .setFlags(vk::CommandBufferUsageFlagBits::eSimultaneousUse);
 
         command_buffers[i].begin(begin_info);
+        begin_gpu_queries(command_buffers[i], slot);
 
         std::array<vk::ClearValue, 2> clear_values{{
             vk::ClearColorValue{std::array<float,4>{{0.0f, 0.0f, 0.0f, 1.0f}}},
@@ -328,7 +327,7 @@ void VertexScene::setup_command_buffers()
 
         auto const render_pass_begin_info = vk::RenderPassBeginInfo{}
             .setRenderPass(render_pass)
-            .setFramebuffer(framebuffers[i])
+            .setFramebuffer(framebuffers[image_index])
             .setRenderArea({{0,0}, extent})
             .setClearValueCount(clear_values.size())
             .setPClearValues(clear_values.data());
@@ -337,7 +336,7 @@ void VertexScene::setup_command_buffers()
 
         command_buffers[i].bindPipeline(vk::PipelineBindPoint::eGraphics, pipeline);
         command_buffers[i].bindDescriptorSets(
-            vk::PipelineBindPoint::eGraphics, pipeline_layout, 0, descriptor_sets[i].raw, {});
+            vk::PipelineBindPoint::eGraphics, pipeline_layout, 0, descriptor_sets[slot].raw, {});
         command_buffers[i].bindVertexBuffers(
             0,
             std::vector<vk::Buffer>{binding_offsets.size(), vertex_buffer.raw},
@@ -347,6 +346,7 @@ void VertexScene::setup_command_buffers()
         command_buffers[i].draw(mesh->num_vertices(), 1, 0, 0);
 
         command_buffers[i].endRenderPass();
+        end_gpu_queries(command_buffers[i], slot);
         command_buffers[i].end();
     }
 }
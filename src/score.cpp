@@ -0,0 +1,133 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "score.h"
+
+#include <cmath>
+
+namespace
+{
+
+BenchmarkResult const* find_reference(
+    BenchmarkResult const& result,
+    std::vector<BenchmarkResult> const& reference)
+{
+    for (auto const& ref : reference)
+    {
+        if (Results::same_benchmark(ref, result))
+            return &ref;
+    }
+
+    return nullptr;
+}
+
+double mean_fps(std::vector<BenchmarkResult> const& results)
+{
+    unsigned int total_fps = 0;
+    unsigned int total_benchmarks = 0;
+
+    for (auto const& r : results)
+    {
+        total_fps += r.fps;
+        ++total_benchmarks;
+    }
+
+    // Integer division, to match scores reported by earlier versions
+    return total_benchmarks == 0 ? 0 : total_fps / total_benchmarks;
+}
+
+double geomean_fps(std::vector<BenchmarkResult> const& results)
+{
+    double log_sum = 0.0;
+    unsigned int count = 0;
+
+    for (auto const& r : results)
+    {
+        if (r.fps == 0)
+            continue;
+        log_sum += std::log(static_cast<double>(r.fps));
+        ++count;
+    }
+
+    return count == 0 ? 0.0 : std::exp(log_sum / count);
+}
+
+double mean_frame_time(std::vector<BenchmarkResult> const& results)
+{
+    double total = 0.0;
+    unsigned int count = 0;
+
+    for (auto const& r : results)
+    {
+        if (r.frames == 0)
+            continue;
+        total += r.frame_time_mean;
+        ++count;
+    }
+
+    return count == 0 ? 0.0 : total / count;
+}
+
+double reference_geomean(std::vector<BenchmarkResult> const& results,
+                         std::vector<BenchmarkResult> const& reference)
+{
+    double log_sum = 0.0;
+    unsigned int count = 0;
+
+    for (auto const& r : results)
+    {
+        auto const ref = find_reference(r, reference);
+        if (r.fps == 0 || !ref || ref->fps == 0)
+            continue;
+        log_sum += std::log(static_cast<double>(r.fps) / ref->fps);
+        ++count;
+    }
+
+    return count == 0 ? 0.0 : 100.0 * std::exp(log_sum / count);
+}
+
+}
+
+std::string to_string(ScoreMethod method)
+{
+    switch (method)
+    {
+        case ScoreMethod::fps: return "fps";
+        case ScoreMethod::geomean: return "geomean";
+        case ScoreMethod::frametime: return "frametime";
+        case ScoreMethod::reference: return "reference";
+    }
+
+    return "unknown";
+}
+
+double Score::calculate(ScoreMethod method,
+                        std::vector<BenchmarkResult> const& results,
+                        std::vector<BenchmarkResult> const& reference)
+{
+    switch (method)
+    {
+        case ScoreMethod::fps: return mean_fps(results);
+        case ScoreMethod::geomean: return geomean_fps(results);
+        case ScoreMethod::frametime: return mean_frame_time(results);
+        case ScoreMethod::reference: return reference_geomean(results, reference);
+    }
+
+    return 0.0;
+}
@@ -0,0 +1,53 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "results.h"
+
+#include <string>
+#include <vector>
+
+enum class ScoreMethod
+{
+    // Arithmetic mean of FPS
+    fps,
+    // Geometric mean of FPS
+    geomean,
+    // Arithmetic mean of the mean frame times, in ms (lower is better)
+    frametime,
+    // Geometric mean of FPS relative to a reference run, scaled so that
+    // matching the reference scores 100
+    reference
+};
+
+std::string to_string(ScoreMethod method);
+
+namespace Score
+{
+
+// ScoreMethod::fps counts every benchmark, to match scores reported by
+// earlier versions. The other methods ignore benchmarks that didn't render
+// any frames, and ScoreMethod::reference also ignores benchmarks that are not
+// present in the reference results (see Results::same_benchmark)
+double calculate(ScoreMethod method,
+                 std::vector<BenchmarkResult> const& results,
+                 std::vector<BenchmarkResult> const& reference);
+
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "setup_timing.h"
+#include "util.h"
+
+#include <algorithm>
+
+void SetupTiming::record(std::string const& name, uint64_t duration)
+{
+    auto const iter = std::find_if(phases_.begin(), phases_.end(),
+                                   [&] (auto const& p) { return p.name == name; });
+
+    if (iter != phases_.end())
+        iter->duration += duration;
+    else
+        phases_.push_back({name, duration});
+}
+
+void SetupTiming::record(SetupTiming const& other)
+{
+    for (auto const& phase : other.phases())
+        record(phase.name, phase.duration);
+}
+
+std::vector<SetupTiming::Phase> const& SetupTiming::phases() const
+{
+    return phases_;
+}
+
+uint64_t SetupTiming::total() const
+{
+    uint64_t sum = 0;
+
+    for (auto const& phase : phases_)
+        sum += phase.duration;
+
+    return sum;
+}
+
+void SetupTiming::reset()
+{
+    phases_.clear();
+}
+
+uint64_t SetupTiming::now()
+{
+    return Util::get_timestamp_us();
+}
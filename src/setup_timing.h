@@ -0,0 +1,66 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Durations of named setup phases, in the order they were first recorded.
+// Recording a phase again adds to its duration.
+class SetupTiming
+{
+public:
+    struct Phase
+    {
+        std::string name;
+        // Duration in microseconds
+        uint64_t duration;
+    };
+
+    void record(std::string const& name, uint64_t duration);
+    // Appends all the phases of another timing
+    void record(SetupTiming const& other);
+
+    template<typename F>
+    auto timed(std::string const& name, F&& func)
+    {
+        struct Recorder
+        {
+            ~Recorder() { timing.record(name, now() - start); }
+            SetupTiming& timing;
+            std::string const& name;
+            uint64_t const start;
+        } const recorder{*this, name, now()};
+
+        return func();
+    }
+
+    std::vector<Phase> const& phases() const;
+    // Sum of the durations of all phases
+    uint64_t total() const;
+    void reset();
+
+private:
+    static uint64_t now();
+
+    std::vector<Phase> phases_;
+};
@@ -0,0 +1,85 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+// A bounded lock-free queue for passing values from exactly one producer
+// thread to exactly one consumer thread. push() must only be called by
+// the producer and pop() only by the consumer.
+template<typename T>
+class SPSCQueue
+{
+public:
+    SPSCQueue(size_t capacity)
+        : slots(capacity + 1), head{0}, tail{0}
+    {
+    }
+
+    size_t capacity() const
+    {
+        return slots.size() - 1;
+    }
+
+    // Returns false if the queue is full
+    bool push(T const& value)
+    {
+        auto const t = tail.load(std::memory_order_relaxed);
+        auto const next = (t + 1) % slots.size();
+
+        if (next == head.load(std::memory_order_acquire))
+            return false;
+
+        slots[t] = value;
+        tail.store(next, std::memory_order_release);
+
+        return true;
+    }
+
+    // Returns false if the queue is empty
+    bool pop(T& value)
+    {
+        auto const h = head.load(std::memory_order_relaxed);
+
+        if (h == tail.load(std::memory_order_acquire))
+            return false;
+
+        value = slots[h];
+        head.store((h + 1) % slots.size(), std::memory_order_release);
+
+        return true;
+    }
+
+    bool empty() const
+    {
+        return head.load(std::memory_order_acquire) ==
+               tail.load(std::memory_order_acquire);
+    }
+
+private:
+    // One slot is always kept free to tell a full queue from an empty one
+    std::vector<T> slots;
+    // Kept on separate cache lines, as each is written by a different thread
+    alignas(64) std::atomic<size_t> head;
+    alignas(64) std::atomic<size_t> tail;
+};
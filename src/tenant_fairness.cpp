@@ -0,0 +1,73 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "tenant_fairness.h"
+#include "log.h"
+
+#include <algorithm>
+#include <string>
+
+TenantFairnessStats TenantFairness::compute(std::vector<unsigned int> const& fps)
+{
+    TenantFairnessStats stats{0, 0, 0.0, 0.0, 0.0};
+
+    if (fps.empty())
+        return stats;
+
+    auto const minmax = std::minmax_element(fps.begin(), fps.end());
+    stats.min_fps = *minmax.first;
+    stats.max_fps = *minmax.second;
+
+    double sum = 0.0;
+    double sum_squares = 0.0;
+    for (auto const f : fps)
+    {
+        sum += f;
+        sum_squares += static_cast<double>(f) * f;
+    }
+
+    stats.mean_fps = sum / fps.size();
+
+    if (stats.max_fps > 0)
+    {
+        stats.fairness = static_cast<double>(stats.min_fps) / stats.max_fps;
+        stats.jain_index = sum * sum / (fps.size() * sum_squares);
+    }
+
+    return stats;
+}
+
+void TenantFairness::log(std::vector<unsigned int> const& fps, TenantFairnessStats const& stats)
+{
+    std::string tenants;
+    for (size_t i = 0; i < fps.size(); ++i)
+        tenants += " [" + std::to_string(i) + "] " + std::to_string(fps[i]);
+
+    auto const fps_fmt = Log::continuation_prefix + " FPS per tenant:%s\n";
+    Log::info(fps_fmt.c_str(), tenants.c_str());
+
+    auto const fairness_fmt = Log::continuation_prefix +
+        "    Tenant FPS min: %u max: %u mean: %.1f Fairness (min/max): %.3f"
+        " Jain index: %.3f\n";
+    Log::info(fairness_fmt.c_str(),
+              stats.min_fps, stats.max_fps, stats.mean_fps,
+              stats.fairness, stats.jain_index);
+    Log::flush();
+}
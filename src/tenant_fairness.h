@@ -0,0 +1,46 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include <vector>
+
+struct TenantFairnessStats
+{
+    unsigned int min_fps;
+    unsigned int max_fps;
+    double mean_fps;
+    // min_fps / max_fps, 1.0 if all tenants got the same throughput
+    double fairness;
+    // Jain's fairness index, (sum x)^2 / (n * sum x^2), between 1/n
+    // (one tenant got all the throughput) and 1.0
+    double jain_index;
+};
+
+namespace TenantFairness
+{
+
+// How evenly the throughput was shared among tenants that ran the same
+// benchmark concurrently
+TenantFairnessStats compute(std::vector<unsigned int> const& fps);
+
+void log(std::vector<unsigned int> const& fps, TenantFairnessStats const& stats);
+
+}
@@ -0,0 +1,144 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "thread_scaling.h"
+#include "log.h"
+#include "util.h"
+
+#include <algorithm>
+
+namespace
+{
+
+bool find_metric(BenchmarkResult const& result, std::string const& name, double& value)
+{
+    for (auto const& metric : result.metrics)
+    {
+        if (metric.first == name)
+        {
+            value = metric.second;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool find_threads(BenchmarkResult const& result, unsigned int& threads)
+{
+    for (auto const& opt : result.options)
+    {
+        if (opt.first == "threads")
+        {
+            threads = Util::from_string<unsigned int>(opt.second);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+std::vector<std::pair<std::string, std::string>> options_without_threads(
+    BenchmarkResult const& result)
+{
+    auto options = result.options;
+
+    options.erase(
+        std::remove_if(options.begin(), options.end(),
+                       [](auto const& opt) { return opt.first == "threads"; }),
+        options.end());
+
+    return options;
+}
+
+}
+
+std::vector<ThreadScalingEntry> ThreadScaling::compute(
+    std::vector<BenchmarkResult> const& results)
+{
+    std::vector<ThreadScalingEntry> entries;
+    std::vector<BenchmarkResult const*> measured;
+
+    for (auto const& result : results)
+    {
+        ThreadScalingEntry entry{result.description, 0, 0.0, false, 0.0, 0.0};
+
+        if (!find_threads(result, entry.threads) ||
+            !find_metric(result, "record_time_ms", entry.record_time_ms))
+        {
+            continue;
+        }
+
+        entries.push_back(entry);
+        measured.push_back(&result);
+    }
+
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        auto& entry = entries[i];
+        auto const options = options_without_threads(*measured[i]);
+
+        for (size_t j = 0; j < entries.size(); ++j)
+        {
+            if (entries[j].threads != 1 ||
+                measured[j]->scene != measured[i]->scene ||
+                options_without_threads(*measured[j]) != options)
+            {
+                continue;
+            }
+
+            if (entries[j].record_time_ms > 0.0 && entry.record_time_ms > 0.0 &&
+                entry.threads > 0)
+            {
+                entry.has_baseline = true;
+                entry.speedup = entries[j].record_time_ms / entry.record_time_ms;
+                entry.efficiency = entry.speedup / entry.threads;
+            }
+            break;
+        }
+    }
+
+    return entries;
+}
+
+bool ThreadScaling::has_scaling(std::vector<ThreadScalingEntry> const& entries)
+{
+    return std::any_of(entries.begin(), entries.end(),
+                       [](auto const& e) { return e.threads > 1; });
+}
+
+void ThreadScaling::log(std::vector<ThreadScalingEntry> const& entries)
+{
+    Log::info("    Thread scaling (command buffer recording)\n");
+
+    for (auto const& e : entries)
+    {
+        if (!e.has_baseline)
+        {
+            Log::info("%s: Record: %.3f ms Speedup: <no threads=1 result>\n",
+                      e.description.c_str(), e.record_time_ms);
+            continue;
+        }
+
+        Log::info("%s: Record: %.3f ms Speedup: %.2fx Efficiency: %.0f%%\n",
+                  e.description.c_str(), e.record_time_ms,
+                  e.speedup, 100.0 * e.efficiency);
+    }
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "results.h"
+
+#include <string>
+#include <vector>
+
+struct ThreadScalingEntry
+{
+    std::string description;
+    unsigned int threads;
+    // Mean wall time to record the command buffers of a frame
+    double record_time_ms;
+    // Only valid if has_baseline is true
+    bool has_baseline;
+    double speedup;
+    // Speedup divided by the number of threads
+    double efficiency;
+};
+
+namespace ThreadScaling
+{
+
+// Collects the results that report a record_time_ms metric and have a
+// threads option, and compares each of them with the single threaded
+// result of the same scene with otherwise equal option values.
+std::vector<ThreadScalingEntry> compute(std::vector<BenchmarkResult> const& results);
+
+// Whether the entries contain any multithreaded result worth reporting
+bool has_scaling(std::vector<ThreadScalingEntry> const& entries);
+
+void log(std::vector<ThreadScalingEntry> const& entries);
+
+}
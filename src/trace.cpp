@@ -0,0 +1,152 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "trace.h"
+
+#include <atomic>
+#include <cinttypes>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+
+namespace
+{
+
+std::unique_ptr<Trace::Event[]> buffer;
+size_t buffer_capacity{0};
+std::atomic<uint64_t> next_event{0};
+std::atomic<uint32_t> next_thread_id{1};
+
+uint64_t get_timestamp_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000 +
+           static_cast<uint64_t>(ts.tv_nsec);
+}
+
+uint32_t current_thread_id()
+{
+    thread_local uint32_t const thread_id = next_thread_id++;
+    return thread_id;
+}
+
+std::string microseconds(uint64_t ns)
+{
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "%" PRIu64 ".%03" PRIu64,
+                  ns / 1000, ns % 1000);
+    return buf;
+}
+
+}
+
+Trace::Scope::Scope(char const* name)
+    : name{name}, start_ns{buffer_capacity ? get_timestamp_ns() : 0}
+{
+}
+
+Trace::Scope::~Scope()
+{
+    if (buffer_capacity)
+        record(name, start_ns, get_timestamp_ns());
+}
+
+void Trace::enable(size_t capacity)
+{
+    buffer = std::make_unique<Event[]>(capacity);
+    buffer_capacity = capacity;
+    next_event = 0;
+}
+
+void Trace::disable()
+{
+    buffer_capacity = 0;
+    buffer.reset();
+    next_event = 0;
+}
+
+bool Trace::is_enabled()
+{
+    return buffer_capacity > 0;
+}
+
+void Trace::record(char const* name, uint64_t start_ns, uint64_t end_ns)
+{
+    if (!buffer_capacity)
+        return;
+
+    // Each writer claims its own slot, so no locking is needed
+    auto const index = next_event.fetch_add(1, std::memory_order_relaxed);
+
+    buffer[index % buffer_capacity] =
+        Event{name, start_ns, end_ns - start_ns, current_thread_id()};
+}
+
+std::vector<Trace::Event> Trace::events()
+{
+    std::vector<Event> ret;
+
+    if (!buffer_capacity)
+        return ret;
+
+    uint64_t const end = next_event;
+    uint64_t const start = end > buffer_capacity ? end - buffer_capacity : 0;
+
+    for (auto i = start; i < end; ++i)
+        ret.push_back(buffer[i % buffer_capacity]);
+
+    return ret;
+}
+
+void Trace::write_chrome_json(std::ostream& os)
+{
+    auto const evs = events();
+
+    os << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+
+    for (size_t i = 0; i < evs.size(); ++i)
+    {
+        auto const& ev = evs[i];
+
+        os << (i == 0 ? "\n" : ",\n")
+           << "{\"name\": \"" << ev.name << "\", \"cat\": \"vkmark\", \"ph\": \"X\", "
+           << "\"ts\": " << microseconds(ev.start_ns) << ", "
+           << "\"dur\": " << microseconds(ev.duration_ns) << ", "
+           << "\"pid\": 1, \"tid\": " << ev.thread_id << "}";
+    }
+
+    os << "\n]}\n";
+}
+
+void Trace::write_file(std::string const& path)
+{
+    std::ofstream ofs{path};
+
+    if (!ofs)
+        throw std::runtime_error{"Failed to open trace file " + path};
+
+    write_chrome_json(ofs);
+
+    if (!ofs)
+        throw std::runtime_error{"Failed to write trace file " + path};
+}
@@ -0,0 +1,75 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+// Records timed CPU events into a fixed-size, lock-free ring buffer. When the
+// buffer is full the oldest events are overwritten. Recording is a no-op
+// until enable() is called.
+class Trace
+{
+public:
+    struct Event
+    {
+        // Must point to a string with static storage duration
+        char const* name;
+        uint64_t start_ns;
+        uint64_t duration_ns;
+        uint32_t thread_id;
+    };
+
+    // Records the duration of the enclosing scope
+    class Scope
+    {
+    public:
+        Scope(char const* name);
+        ~Scope();
+
+    private:
+        char const* const name;
+        uint64_t const start_ns;
+    };
+
+    static size_t const default_capacity = 262144;
+
+    static void enable(size_t capacity = default_capacity);
+    static void disable();
+    static bool is_enabled();
+
+    static void record(char const* name, uint64_t start_ns, uint64_t end_ns);
+
+    // Events still held in the buffer, oldest first. Must not be called
+    // while events are being recorded.
+    static std::vector<Event> events();
+    static void write_chrome_json(std::ostream& os);
+    static void write_file(std::string const& path);
+
+    template<typename F>
+    static auto traced(char const* name, F&& func)
+    {
+        Scope const scope{name};
+        return func();
+    }
+};
@@ -25,6 +25,7 @@
 #include <sys/time.h>
 
 #include "util.h"
+#include <algorithm>
 #include <stdexcept>
 
 #define STB_IMAGE_IMPLEMENTATION
@@ -35,6 +36,43 @@
 namespace
 {
 std::string data_dir;
+
+uint32_t png_crc(std::vector<unsigned char> const& bytes, size_t begin)
+{
+    uint32_t crc = 0xffffffff;
+
+    for (size_t i = begin; i < bytes.size(); ++i)
+    {
+        crc ^= bytes[i];
+        for (int k = 0; k < 8; ++k)
+            crc = (crc >> 1) ^ (0xedb88320 & (0 - (crc & 1)));
+    }
+
+    return ~crc;
+}
+
+void append_be32(std::vector<unsigned char>& bytes, uint32_t value)
+{
+    bytes.push_back(value >> 24);
+    bytes.push_back(value >> 16);
+    bytes.push_back(value >> 8);
+    bytes.push_back(value);
+}
+
+void append_png_chunk(std::ostream& os, char const* type,
+                      std::vector<unsigned char> const& data)
+{
+    std::vector<unsigned char> chunk;
+
+    append_be32(chunk, data.size());
+    chunk.insert(chunk.end(), type, type + 4);
+    chunk.insert(chunk.end(), data.begin(), data.end());
+    // The CRC covers the type and the data, but not the length
+    append_be32(chunk, png_crc(chunk, 4));
+
+    os.write(reinterpret_cast<char const*>(chunk.data()), chunk.size());
+}
+
 }
 
 std::vector<std::string> Util::split(std::string const& src, char delim)
@@ -130,8 +168,11 @@ Util::Image& Util::Image::operator=(Image&& other)
 
 Util::Image Util::read_image_file(std::string const& rel_path)
 {
-    auto const path = get_data_file_path(rel_path);
+    return load_image_file(get_data_file_path(rel_path));
+}
 
+Util::Image Util::load_image_file(std::string const& path)
+{
     int w = 0;
     int h = 0;
     int c = 0;
@@ -151,3 +192,67 @@ Util::Image Util::read_image_file(std::string const& rel_path)
 
     return image;
 }
+
+void Util::write_png_file(std::string const& path, unsigned char const* data,
+                          size_t width, size_t height)
+{
+    static unsigned char const signature[] = {137, 'P', 'N', 'G', '\r', '\n', 26, '\n'};
+    static size_t const max_block_size = 65535;
+
+    std::ofstream ofs{path, std::ios::binary};
+    if (!ofs)
+        throw std::runtime_error{"Failed to open image file " + path};
+
+    std::vector<unsigned char> header;
+    append_be32(header, width);
+    append_be32(header, height);
+    // 8 bits per channel, RGBA, deflate, adaptive filtering, no interlacing
+    header.insert(header.end(), {8, 6, 0, 0, 0});
+
+    // Each row starts with its filter type (0, none)
+    auto const row_size = 4 * width;
+    std::vector<unsigned char> raw;
+    raw.reserve((row_size + 1) * height);
+    for (size_t y = 0; y < height; ++y)
+    {
+        raw.push_back(0);
+        raw.insert(raw.end(), data + y * row_size, data + (y + 1) * row_size);
+    }
+
+    // A zlib stream of stored (uncompressed) deflate blocks, which is
+    // larger than needed but fast and simple to write
+    std::vector<unsigned char> zlib{0x78, 0x01};
+    size_t offset = 0;
+    do
+    {
+        auto const block_size = std::min(raw.size() - offset, max_block_size);
+        bool const last = offset + block_size == raw.size();
+
+        zlib.push_back(last ? 1 : 0);
+        zlib.push_back(block_size & 0xff);
+        zlib.push_back(block_size >> 8);
+        zlib.push_back(~block_size & 0xff);
+        zlib.push_back((~block_size >> 8) & 0xff);
+        zlib.insert(zlib.end(), raw.begin() + offset, raw.begin() + offset + block_size);
+
+        offset += block_size;
+    }
+    while (offset < raw.size());
+
+    uint32_t a = 1;
+    uint32_t b = 0;
+    for (auto const byte : raw)
+    {
+        a = (a + byte) % 65521;
+        b = (b + a) % 65521;
+    }
+    append_be32(zlib, (b << 16) | a);
+
+    ofs.write(reinterpret_cast<char const*>(signature), sizeof(signature));
+    append_png_chunk(ofs, "IHDR", header);
+    append_png_chunk(ofs, "IDAT", zlib);
+    append_png_chunk(ofs, "IEND", {});
+
+    if (!ofs)
+        throw std::runtime_error{"Failed to write image file " + path};
+}
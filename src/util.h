@@ -52,6 +52,11 @@ struct Image
 };
 
 Image read_image_file(std::string const& rel_path);
+// Reads an image file from an arbitrary path, as RGBA
+Image load_image_file(std::string const& path);
+// Writes RGBA pixel data as an uncompressed PNG file
+void write_png_file(std::string const& path, unsigned char const* data,
+                    size_t width, size_t height);
 
 template<typename T>
 T from_string(std::string const& str)
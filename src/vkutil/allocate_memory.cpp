@@ -0,0 +1,56 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "allocate_memory.h"
+
+#include "vulkan_state.h"
+#include "device_memory_tracker.h"
+
+namespace
+{
+
+uint64_t memory_id(vk::DeviceMemory memory)
+{
+    return (uint64_t)static_cast<VkDeviceMemory>(memory);
+}
+
+}
+
+ManagedResource<vk::DeviceMemory> vkutil::allocate_memory(
+    VulkanState& vulkan,
+    vk::MemoryAllocateInfo const& allocate_info)
+{
+    auto memory = vulkan.device().allocateMemory(allocate_info);
+
+    vulkan.memory_tracker().allocated(
+        memory_id(memory), allocate_info.memoryTypeIndex, allocate_info.allocationSize);
+
+    return ManagedResource<vk::DeviceMemory>{
+        std::move(memory),
+        [vptr=&vulkan] (auto const& m) { vkutil::free_memory(*vptr, m); }};
+}
+
+void vkutil::free_memory(VulkanState& vulkan, vk::DeviceMemory memory)
+{
+    if (!memory)
+        return;
+
+    vulkan.memory_tracker().freed(memory_id(memory));
+    vulkan.device().freeMemory(memory);
+}
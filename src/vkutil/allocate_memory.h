@@ -0,0 +1,40 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <vulkan/vulkan.hpp>
+
+#include "managed_resource.h"
+
+class VulkanState;
+
+namespace vkutil
+{
+
+// Allocates device memory and records it in the VulkanState's memory tracker
+ManagedResource<vk::DeviceMemory> allocate_memory(
+    VulkanState& vulkan,
+    vk::MemoryAllocateInfo const& allocate_info);
+
+// Frees memory allocated with allocate_memory(), for use after the memory
+// has been stolen from its ManagedResource
+void free_memory(VulkanState& vulkan, vk::DeviceMemory memory);
+
+}
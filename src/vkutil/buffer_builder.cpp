@@ -21,10 +21,13 @@
  */
 
 #include "buffer_builder.h"
+#include "allocate_memory.h"
 #include "find_matching_memory_type.h"
 
 #include "vulkan_state.h"
 
+#include <algorithm>
+
 vkutil::BufferBuilder::BufferBuilder(VulkanState& vulkan)
     : vulkan{vulkan},
       size{0},
@@ -58,12 +61,26 @@ vkutil::BufferBuilder& vkutil::BufferBuilder::set_memory_out(
     return *this;
 }
 
+vkutil::BufferBuilder& vkutil::BufferBuilder::set_queue_family_indices(
+    std::vector<uint32_t> const& indices)
+{
+    queue_family_indices = indices;
+    std::sort(queue_family_indices.begin(), queue_family_indices.end());
+    queue_family_indices.erase(
+        std::unique(queue_family_indices.begin(), queue_family_indices.end()),
+        queue_family_indices.end());
+    return *this;
+}
+
 ManagedResource<vk::Buffer> vkutil::BufferBuilder::build()
 {
+    auto const concurrent = queue_family_indices.size() > 1;
     auto const vertex_buffer_create_info = vk::BufferCreateInfo{}
         .setSize(size)
         .setUsage(usage)
-        .setSharingMode(vk::SharingMode::eExclusive);
+        .setSharingMode(concurrent ? vk::SharingMode::eConcurrent : vk::SharingMode::eExclusive)
+        .setQueueFamilyIndexCount(concurrent ? queue_family_indices.size() : 0)
+        .setPQueueFamilyIndices(queue_family_indices.data());
 
     auto vk_buffer = ManagedResource<vk::Buffer>{
         vulkan.device().createBuffer(vertex_buffer_create_info),
@@ -77,9 +94,7 @@ ManagedResource<vk::Buffer> vkutil::BufferBuilder::build()
         .setAllocationSize(mem_requirements.size)
         .setMemoryTypeIndex(mem_type);
 
-    auto vk_mem = ManagedResource<vk::DeviceMemory>{
-        vulkan.device().allocateMemory(memory_allocate_info),
-        [vptr=&vulkan] (auto const& m) { vptr->device().freeMemory(m); }};
+    auto vk_mem = vkutil::allocate_memory(vulkan, memory_allocate_info);
 
     vulkan.device().bindBufferMemory(vk_buffer, vk_mem, 0);
 
@@ -91,7 +106,7 @@ ManagedResource<vk::Buffer> vkutil::BufferBuilder::build()
         [vptr=&vulkan, mem=vk_mem.steal()]
         (auto const& b)
         {
-            vptr->device().freeMemory(mem);
+            vkutil::free_memory(*vptr, mem);
             vptr->device().destroyBuffer(b);
         }};
 }
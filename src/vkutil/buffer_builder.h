@@ -40,6 +40,9 @@ public:
     BufferBuilder& set_usage(vk::BufferUsageFlags usage);
     BufferBuilder& set_memory_properties(vk::MemoryPropertyFlags memory_properties);
     BufferBuilder& set_memory_out(vk::DeviceMemory& memory_out);
+    // Shares the buffer concurrently between the queue families, if they
+    // are more than one, instead of requiring ownership transfers
+    BufferBuilder& set_queue_family_indices(std::vector<uint32_t> const& indices);
 
     ManagedResource<vk::Buffer> build();
 
@@ -51,6 +54,7 @@ private:
     vk::BufferUsageFlags usage;
     vk::MemoryPropertyFlags memory_properties;
     vk::DeviceMemory* memory_out_ptr;
+    std::vector<uint32_t> queue_family_indices;
 };
 
 }
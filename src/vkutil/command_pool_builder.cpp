@@ -0,0 +1,54 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "command_pool_builder.h"
+
+#include "vulkan_state.h"
+
+vkutil::CommandPoolBuilder::CommandPoolBuilder(VulkanState& vulkan)
+    : vulkan{vulkan},
+      queue_family_index{vulkan.graphics_queue_family_index()}
+{
+}
+
+vkutil::CommandPoolBuilder& vkutil::CommandPoolBuilder::set_queue_family_index(
+    uint32_t queue_family_index_)
+{
+    queue_family_index = queue_family_index_;
+    return *this;
+}
+
+vkutil::CommandPoolBuilder& vkutil::CommandPoolBuilder::set_flags(
+    vk::CommandPoolCreateFlags flags_)
+{
+    flags = flags_;
+    return *this;
+}
+
+ManagedResource<vk::CommandPool> vkutil::CommandPoolBuilder::build()
+{
+    auto const command_pool_create_info = vk::CommandPoolCreateInfo{}
+        .setQueueFamilyIndex(queue_family_index)
+        .setFlags(flags);
+
+    return ManagedResource<vk::CommandPool>{
+        vulkan.device().createCommandPool(command_pool_create_info),
+        [vptr=&vulkan] (auto const& cp) { vptr->device().destroyCommandPool(cp); }};
+}
@@ -0,0 +1,51 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include <vulkan/vulkan.hpp>
+
+#include "managed_resource.h"
+
+class VulkanState;
+
+namespace vkutil
+{
+
+// Builds command pools, by default for the graphics queue family. Command
+// pools must only be used by one thread at a time, so multithreaded
+// recording needs a pool per thread.
+class CommandPoolBuilder
+{
+public:
+    CommandPoolBuilder(VulkanState& vulkan);
+
+    CommandPoolBuilder& set_queue_family_index(uint32_t queue_family_index);
+    CommandPoolBuilder& set_flags(vk::CommandPoolCreateFlags flags);
+
+    ManagedResource<vk::CommandPool> build();
+
+private:
+    VulkanState& vulkan;
+    uint32_t queue_family_index;
+    vk::CommandPoolCreateFlags flags;
+};
+
+}
@@ -21,6 +21,7 @@
  */
 
 #include "image_builder.h"
+#include "allocate_memory.h"
 #include "find_matching_memory_type.h"
 
 #include "vulkan_state.h"
@@ -96,9 +97,7 @@ ManagedResource<vk::Image> vkutil::ImageBuilder::build()
         .setAllocationSize(req.size)
         .setMemoryTypeIndex(memory_type_index);
 
-    auto vk_mem = ManagedResource<vk::DeviceMemory>{
-        vulkan.device().allocateMemory(memory_allocate_info),
-        [vptr=&vulkan] (auto const& m) { vptr->device().freeMemory(m); }};
+    auto vk_mem = vkutil::allocate_memory(vulkan, memory_allocate_info);
 
     vulkan.device().bindImageMemory(vk_image, vk_mem, 0);
 
@@ -107,7 +106,7 @@ ManagedResource<vk::Image> vkutil::ImageBuilder::build()
         [vptr=&vulkan, mem=vk_mem.steal()]
         (auto const& i)
         {
-            vptr->device().freeMemory(mem);
+            vkutil::free_memory(*vptr, mem);
             vptr->device().destroyImage(i);
         }};
 }
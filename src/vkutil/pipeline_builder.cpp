@@ -209,3 +209,44 @@ ManagedResource<vk::Pipeline> vkutil::PipelineBuilder::build()
 #endif
         [vptr=&vulkan] (auto const& p) { vptr->device().destroyPipeline(p); }};
 }
+
+vkutil::ComputePipelineBuilder::ComputePipelineBuilder(VulkanState& vulkan)
+    : vulkan{vulkan}
+{
+}
+
+vkutil::ComputePipelineBuilder& vkutil::ComputePipelineBuilder::set_compute_shader(
+    std::vector<char> const& spirv)
+{
+    compute_shader_spirv = spirv;
+    return *this;
+}
+
+vkutil::ComputePipelineBuilder& vkutil::ComputePipelineBuilder::set_layout(
+    vk::PipelineLayout layout_)
+{
+    layout = layout_;
+    return *this;
+}
+
+ManagedResource<vk::Pipeline> vkutil::ComputePipelineBuilder::build()
+{
+    auto const compute_shader = create_shader_module(vulkan.device(), compute_shader_spirv);
+
+    auto const compute_shader_stage_create_info = vk::PipelineShaderStageCreateInfo{}
+        .setStage(vk::ShaderStageFlagBits::eCompute)
+        .setModule(compute_shader)
+        .setPName("main");
+
+    auto const pipeline_create_info = vk::ComputePipelineCreateInfo{}
+        .setStage(compute_shader_stage_create_info)
+        .setLayout(layout);
+
+    return ManagedResource<vk::Pipeline>{
+#if VK_HEADER_VERSION > 148
+        vulkan.device().createComputePipeline({}, pipeline_create_info).value,
+#else
+        vulkan.device().createComputePipeline({}, pipeline_create_info),
+#endif
+        [vptr=&vulkan] (auto const& p) { vptr->device().destroyPipeline(p); }};
+}
@@ -62,4 +62,20 @@ private:
     vk::RenderPass render_pass;
 };
 
+class ComputePipelineBuilder
+{
+public:
+    ComputePipelineBuilder(VulkanState& vulkan);
+
+    ComputePipelineBuilder& set_compute_shader(std::vector<char> const& spirv);
+    ComputePipelineBuilder& set_layout(vk::PipelineLayout layout);
+
+    ManagedResource<vk::Pipeline> build();
+
+private:
+    VulkanState& vulkan;
+    std::vector<char> compute_shader_spirv;
+    vk::PipelineLayout layout;
+};
+
 }
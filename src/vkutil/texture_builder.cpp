@@ -25,40 +25,24 @@
 #include "util.h"
 #include "vulkan_state.h"
 
-#include "buffer_builder.h"
-#include "copy_buffer.h"
 #include "image_builder.h"
 #include "image_view_builder.h"
-#include "transition_image_layout.h"
+#include "upload_batcher.h"
 
 namespace
 {
 
 void texture_setup_image(VulkanState& vulkan,
                          vkutil::Texture& texture,
-                         Util::Image const& image)
+                         Util::Image const& image,
+                         vkutil::UploadBatcher& upload_batcher)
 {
     auto const texture_format = vk::Format::eR8G8B8A8Srgb;
-    vk::DeviceMemory staging_buffer_memory;
 
     auto const image_extent = vk::Extent2D{
         static_cast<uint32_t>(image.width),
         static_cast<uint32_t>(image.height)};
 
-    auto staging_buffer = vkutil::BufferBuilder{vulkan}
-        .set_size(image.size)
-        .set_usage(vk::BufferUsageFlagBits::eTransferSrc)
-        .set_memory_properties(
-            vk::MemoryPropertyFlagBits::eHostVisible |
-            vk::MemoryPropertyFlagBits::eHostCoherent)
-        .set_memory_out(staging_buffer_memory)
-        .build();
-
-    auto const staging_buffer_map = vulkan.device().mapMemory(
-        staging_buffer_memory, 0, image.size);
-    memcpy(staging_buffer_map, image.data, image.size);
-    vulkan.device().unmapMemory(staging_buffer_memory);
-
     texture.image = vkutil::ImageBuilder{vulkan}
         .set_extent(image_extent)
         .set_format(texture_format)
@@ -66,24 +50,10 @@ void texture_setup_image(VulkanState& vulkan,
         .set_usage(vk::ImageUsageFlagBits::eTransferDst |
                    vk::ImageUsageFlagBits::eSampled)
         .set_memory_properties(vk::MemoryPropertyFlagBits::eDeviceLocal)
-        .set_initial_layout(vk::ImageLayout::ePreinitialized)
+        .set_initial_layout(vk::ImageLayout::eUndefined)
         .build();
 
-    vkutil::transition_image_layout(
-        vulkan,
-        texture.image,
-        vk::ImageLayout::ePreinitialized,
-        vk::ImageLayout::eTransferDstOptimal,
-        vk::ImageAspectFlagBits::eColor);
-
-    vkutil::copy_buffer_to_image(vulkan, staging_buffer, texture.image, image_extent);
-
-    vkutil::transition_image_layout(
-        vulkan,
-        texture.image,
-        vk::ImageLayout::eTransferDstOptimal,
-        vk::ImageLayout::eShaderReadOnlyOptimal,
-        vk::ImageAspectFlagBits::eColor);
+    upload_batcher.add_image(texture.image, image_extent, image.data, image.size);
 
     texture.image_view = vkutil::ImageViewBuilder{vulkan}
         .set_image(texture.image)
@@ -121,7 +91,8 @@ void texture_setup_sampler(VulkanState& vulkan,
 vkutil::TextureBuilder::TextureBuilder(VulkanState& vulkan)
     : vulkan{vulkan},
       filter{vk::Filter::eNearest},
-      anisotropy{0.0f}
+      anisotropy{0.0f},
+      upload_batcher{nullptr}
 {
 }
 
@@ -143,13 +114,30 @@ vkutil::TextureBuilder& vkutil::TextureBuilder::set_anisotropy(float a)
     return *this;
 }
 
+vkutil::TextureBuilder& vkutil::TextureBuilder::set_upload_batcher(
+    UploadBatcher& upload_batcher_)
+{
+    upload_batcher = &upload_batcher_;
+    return *this;
+}
+
 vkutil::Texture vkutil::TextureBuilder::build()
 {
     Texture texture;
 
     auto const image = Util::read_image_file(file);
 
-    texture_setup_image(vulkan, texture, image);
+    if (upload_batcher)
+    {
+        texture_setup_image(vulkan, texture, image, *upload_batcher);
+    }
+    else
+    {
+        UploadBatcher own_upload_batcher{vulkan};
+        texture_setup_image(vulkan, texture, image, own_upload_batcher);
+        own_upload_batcher.submit();
+    }
+
     texture_setup_sampler(vulkan, texture, filter, anisotropy);
 
     return texture;
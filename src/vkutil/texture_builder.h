@@ -32,6 +32,7 @@ namespace vkutil
 {
 
 struct Texture;
+class UploadBatcher;
 
 class TextureBuilder
 {
@@ -41,6 +42,10 @@ public:
     TextureBuilder& set_file(std::string const& file);
     TextureBuilder& set_filter(vk::Filter filter);
     TextureBuilder& set_anisotropy(float anisotropy);
+    // Adds the image upload to the batcher instead of performing it
+    // immediately, so the texture must not be used before the batcher
+    // is submitted
+    TextureBuilder& set_upload_batcher(UploadBatcher& upload_batcher);
 
     Texture build();
 
@@ -49,6 +54,7 @@ private:
     std::string file;
     vk::Filter filter;
     float anisotropy;
+    UploadBatcher* upload_batcher;
 };
 
 }
@@ -0,0 +1,314 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "upload_batcher.h"
+
+#include "buffer_builder.h"
+#include "command_pool_builder.h"
+#include "map_memory.h"
+#include "semaphore_builder.h"
+
+#include "managed_resource.h"
+#include "trace.h"
+#include "vulkan_state.h"
+
+#include <cstring>
+
+namespace
+{
+
+// Satisfies the alignment requirements of buffer to image copies for
+// all formats
+vk::DeviceSize const staging_alignment = 16;
+
+vk::ImageSubresourceRange color_subresource_range()
+{
+    return vk::ImageSubresourceRange{}
+        .setAspectMask(vk::ImageAspectFlagBits::eColor)
+        .setBaseMipLevel(0)
+        .setLevelCount(1)
+        .setBaseArrayLayer(0)
+        .setLayerCount(1);
+}
+
+vk::CommandBuffer allocate_command_buffer(VulkanState& vulkan, vk::CommandPool pool)
+{
+    auto const command_buffer_allocate_info = vk::CommandBufferAllocateInfo{}
+        .setCommandPool(pool)
+        .setCommandBufferCount(1)
+        .setLevel(vk::CommandBufferLevel::ePrimary);
+
+    auto const command_buffer =
+        vulkan.device().allocateCommandBuffers(command_buffer_allocate_info)[0];
+
+    command_buffer.begin(
+        vk::CommandBufferBeginInfo{}
+            .setFlags(vk::CommandBufferUsageFlagBits::eOneTimeSubmit));
+
+    return command_buffer;
+}
+
+}
+
+vkutil::UploadBatcher::UploadBatcher(VulkanState& vulkan)
+    : vulkan{vulkan}
+{
+}
+
+vkutil::UploadBatcher& vkutil::UploadBatcher::add_buffer(
+    vk::Buffer dst, void const* data, vk::DeviceSize size)
+{
+    add(Upload{dst, nullptr, {}, 0, size}, data);
+    return *this;
+}
+
+vkutil::UploadBatcher& vkutil::UploadBatcher::add_image(
+    vk::Image dst, vk::Extent2D extent, void const* data, vk::DeviceSize size)
+{
+    add(Upload{nullptr, dst, extent, 0, size}, data);
+    return *this;
+}
+
+void vkutil::UploadBatcher::add(Upload const& upload, void const* data)
+{
+    auto const offset =
+        (staging_data.size() + staging_alignment - 1) / staging_alignment * staging_alignment;
+
+    staging_data.resize(offset + upload.size);
+    memcpy(staging_data.data() + offset, data, upload.size);
+
+    uploads.push_back(upload);
+    uploads.back().offset = offset;
+}
+
+void vkutil::UploadBatcher::submit()
+{
+    if (uploads.empty())
+        return;
+
+    Trace::Scope const trace{"upload_batch"};
+
+    vk::DeviceMemory staging_buffer_memory;
+
+    auto const staging_buffer = vkutil::BufferBuilder{vulkan}
+        .set_size(staging_data.size())
+        .set_usage(vk::BufferUsageFlagBits::eTransferSrc)
+        .set_memory_properties(
+            vk::MemoryPropertyFlagBits::eHostVisible |
+            vk::MemoryPropertyFlagBits::eHostCoherent)
+        .set_memory_out(staging_buffer_memory)
+        .build();
+
+    {
+        auto const staging_buffer_map = vkutil::map_memory(
+            vulkan, staging_buffer_memory, 0, staging_data.size());
+        memcpy(staging_buffer_map, staging_data.data(), staging_data.size());
+    }
+
+    auto const fence = ManagedResource<vk::Fence>{
+        vulkan.device().createFence(vk::FenceCreateInfo{}),
+        [vptr=&vulkan] (auto const& f) { vptr->device().destroyFence(f); }};
+
+    // The pools and the semaphore are destroyed after the wait below,
+    // which also frees the command buffers
+    auto const transfer_pool = vkutil::CommandPoolBuilder{vulkan}
+        .set_queue_family_index(vulkan.transfer_queue_family_index())
+        .set_flags(vk::CommandPoolCreateFlagBits::eTransient)
+        .build();
+    ManagedResource<vk::CommandPool> graphics_pool;
+    ManagedResource<vk::Semaphore> semaphore;
+
+    auto const transfer_command_buffer = allocate_command_buffer(vulkan, transfer_pool);
+    record_copies(transfer_command_buffer, staging_buffer, vulkan.has_transfer_queue());
+    transfer_command_buffer.end();
+
+    if (vulkan.has_transfer_queue())
+    {
+        graphics_pool = vkutil::CommandPoolBuilder{vulkan}
+            .set_flags(vk::CommandPoolCreateFlagBits::eTransient)
+            .build();
+        semaphore = vkutil::SemaphoreBuilder{vulkan}.build();
+
+        auto const acquire_command_buffer = allocate_command_buffer(vulkan, graphics_pool);
+        record_acquire(acquire_command_buffer);
+        acquire_command_buffer.end();
+
+        vk::PipelineStageFlags const wait_stage = vk::PipelineStageFlagBits::eAllCommands;
+
+        auto const transfer_submit_info = vk::SubmitInfo{}
+            .setCommandBufferCount(1)
+            .setPCommandBuffers(&transfer_command_buffer)
+            .setSignalSemaphoreCount(1)
+            .setPSignalSemaphores(&semaphore.raw);
+
+        auto const acquire_submit_info = vk::SubmitInfo{}
+            .setWaitSemaphoreCount(1)
+            .setPWaitSemaphores(&semaphore.raw)
+            .setPWaitDstStageMask(&wait_stage)
+            .setCommandBufferCount(1)
+            .setPCommandBuffers(&acquire_command_buffer);
+
+        vulkan.transfer_queue().submit(transfer_submit_info, {});
+        vulkan.graphics_queue().submit(acquire_submit_info, fence);
+    }
+    else
+    {
+        auto const submit_info = vk::SubmitInfo{}
+            .setCommandBufferCount(1)
+            .setPCommandBuffers(&transfer_command_buffer);
+
+        vulkan.graphics_queue().submit(submit_info, fence);
+    }
+
+    Trace::traced("wait_upload_fence", [&] {
+        (void)vulkan.device().waitForFences(fence.raw, true, INT64_MAX);
+    });
+
+    uploads.clear();
+    staging_data.clear();
+}
+
+void vkutil::UploadBatcher::record_copies(
+    vk::CommandBuffer command_buffer, vk::Buffer staging_buffer, bool release)
+{
+    auto const ignored = VK_QUEUE_FAMILY_IGNORED;
+
+    command_buffer.pipelineBarrier(
+        vk::PipelineStageFlagBits::eTopOfPipe,
+        vk::PipelineStageFlagBits::eTransfer,
+        {}, {}, {},
+        image_barriers(vk::ImageLayout::eUndefined, vk::ImageLayout::eTransferDstOptimal,
+                       {}, vk::AccessFlagBits::eTransferWrite, ignored, ignored));
+
+    for (auto const& upload : uploads)
+    {
+        if (upload.buffer)
+        {
+            auto const region = vk::BufferCopy{}
+                .setSrcOffset(upload.offset)
+                .setSize(upload.size);
+
+            command_buffer.copyBuffer(staging_buffer, upload.buffer, region);
+        }
+        else
+        {
+            auto const region = vk::BufferImageCopy{}
+                .setBufferOffset(upload.offset)
+                .setImageSubresource(
+                    vk::ImageSubresourceLayers{}
+                        .setAspectMask(vk::ImageAspectFlagBits::eColor)
+                        .setMipLevel(0)
+                        .setBaseArrayLayer(0)
+                        .setLayerCount(1))
+                .setImageOffset({0, 0, 0})
+                .setImageExtent({upload.extent.width, upload.extent.height, 1});
+
+            command_buffer.copyBufferToImage(
+                staging_buffer, upload.image, vk::ImageLayout::eTransferDstOptimal, region);
+        }
+    }
+
+    // When releasing to another queue family, visibility is provided by
+    // the matching acquire barriers instead
+    auto const src_family = release ? vulkan.transfer_queue_family_index() : ignored;
+    auto const dst_family = release ? vulkan.graphics_queue_family_index() : ignored;
+    auto const dst_access = release ? vk::AccessFlags{} : vk::AccessFlagBits::eMemoryRead;
+    auto const dst_stage = release ? vk::PipelineStageFlagBits::eBottomOfPipe
+                                   : vk::PipelineStageFlagBits::eAllCommands;
+
+    command_buffer.pipelineBarrier(
+        vk::PipelineStageFlagBits::eTransfer,
+        dst_stage,
+        {}, {},
+        buffer_barriers(vk::AccessFlagBits::eTransferWrite, dst_access,
+                        src_family, dst_family),
+        image_barriers(vk::ImageLayout::eTransferDstOptimal,
+                       vk::ImageLayout::eShaderReadOnlyOptimal,
+                       vk::AccessFlagBits::eTransferWrite, dst_access,
+                       src_family, dst_family));
+}
+
+void vkutil::UploadBatcher::record_acquire(vk::CommandBuffer command_buffer)
+{
+    auto const src_family = vulkan.transfer_queue_family_index();
+    auto const dst_family = vulkan.graphics_queue_family_index();
+
+    command_buffer.pipelineBarrier(
+        vk::PipelineStageFlagBits::eTopOfPipe,
+        vk::PipelineStageFlagBits::eAllCommands,
+        {}, {},
+        buffer_barriers({}, vk::AccessFlagBits::eMemoryRead, src_family, dst_family),
+        image_barriers(vk::ImageLayout::eTransferDstOptimal,
+                       vk::ImageLayout::eShaderReadOnlyOptimal,
+                       {}, vk::AccessFlagBits::eMemoryRead,
+                       src_family, dst_family));
+}
+
+std::vector<vk::BufferMemoryBarrier> vkutil::UploadBatcher::buffer_barriers(
+    vk::AccessFlags src_access, vk::AccessFlags dst_access,
+    uint32_t src_family, uint32_t dst_family) const
+{
+    std::vector<vk::BufferMemoryBarrier> barriers;
+
+    for (auto const& upload : uploads)
+    {
+        if (!upload.buffer)
+            continue;
+
+        barriers.push_back(
+            vk::BufferMemoryBarrier{}
+                .setBuffer(upload.buffer)
+                .setOffset(0)
+                .setSize(VK_WHOLE_SIZE)
+                .setSrcAccessMask(src_access)
+                .setDstAccessMask(dst_access)
+                .setSrcQueueFamilyIndex(src_family)
+                .setDstQueueFamilyIndex(dst_family));
+    }
+
+    return barriers;
+}
+
+std::vector<vk::ImageMemoryBarrier> vkutil::UploadBatcher::image_barriers(
+    vk::ImageLayout old_layout, vk::ImageLayout new_layout,
+    vk::AccessFlags src_access, vk::AccessFlags dst_access,
+    uint32_t src_family, uint32_t dst_family) const
+{
+    std::vector<vk::ImageMemoryBarrier> barriers;
+
+    for (auto const& upload : uploads)
+    {
+        if (!upload.image)
+            continue;
+
+        barriers.push_back(
+            vk::ImageMemoryBarrier{}
+                .setImage(upload.image)
+                .setOldLayout(old_layout)
+                .setNewLayout(new_layout)
+                .setSrcAccessMask(src_access)
+                .setDstAccessMask(dst_access)
+                .setSrcQueueFamilyIndex(src_family)
+                .setDstQueueFamilyIndex(dst_family)
+                .setSubresourceRange(color_subresource_range()));
+    }
+
+    return barriers;
+}
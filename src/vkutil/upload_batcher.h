@@ -0,0 +1,80 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include <vulkan/vulkan.hpp>
+
+#include <vector>
+
+class VulkanState;
+
+namespace vkutil
+{
+
+// Collects the setup-time uploads of a scene and performs all of them with
+// a single command buffer submission and a single wait. If the device has
+// a dedicated transfer queue the copies run on it, and the ownership of
+// the destinations is then transferred to the graphics queue family.
+class UploadBatcher
+{
+public:
+    UploadBatcher(VulkanState& vulkan);
+
+    // The data is copied, so it doesn't need to outlive the calls.
+    // Destinations must not be used before submit() returns.
+    UploadBatcher& add_buffer(vk::Buffer dst, void const* data, vk::DeviceSize size);
+    // The image is transitioned from an undefined layout to
+    // eShaderReadOnlyOptimal
+    UploadBatcher& add_image(vk::Image dst, vk::Extent2D extent,
+                             void const* data, vk::DeviceSize size);
+
+    // Records and submits all pending uploads, and waits for them to
+    // complete. Does nothing if there are no pending uploads.
+    void submit();
+
+private:
+    struct Upload
+    {
+        vk::Buffer buffer;
+        vk::Image image;
+        vk::Extent2D extent;
+        vk::DeviceSize offset;
+        vk::DeviceSize size;
+    };
+
+    void add(Upload const& upload, void const* data);
+    void record_copies(vk::CommandBuffer command_buffer,
+                       vk::Buffer staging_buffer, bool release);
+    void record_acquire(vk::CommandBuffer command_buffer);
+    std::vector<vk::BufferMemoryBarrier> buffer_barriers(
+        vk::AccessFlags src_access, vk::AccessFlags dst_access,
+        uint32_t src_family, uint32_t dst_family) const;
+    std::vector<vk::ImageMemoryBarrier> image_barriers(
+        vk::ImageLayout old_layout, vk::ImageLayout new_layout,
+        vk::AccessFlags src_access, vk::AccessFlags dst_access,
+        uint32_t src_family, uint32_t dst_family) const;
+
+    VulkanState& vulkan;
+    std::vector<Upload> uploads;
+    std::vector<char> staging_data;
+};
+
+}
@@ -22,7 +22,9 @@
 
 #pragma once
 
+#include "allocate_memory.h"
 #include "buffer_builder.h"
+#include "command_pool_builder.h"
 #include "copy_buffer.h"
 #include "descriptor_set_builder.h"
 #include "find_matching_memory_type.h"
@@ -36,3 +38,4 @@
 #include "texture.h"
 #include "texture_builder.h"
 #include "transition_image_layout.h"
+#include "upload_batcher.h"
@@ -28,7 +28,14 @@ struct VulkanImage
 {
     VulkanImage copy_with_semaphore(vk::Semaphore sem) const
     {
-        return {index, image, format, extent, sem, submit_fence};
+        return {index, image, format, extent, sem, submit_fence,
+                timeline_semaphore, timeline_value};
+    }
+
+    VulkanImage copy_with_timeline(vk::Semaphore sem, uint64_t value) const
+    {
+        return {index, image, format, extent, semaphore, submit_fence,
+                sem, value};
     }
 
     uint32_t index;
@@ -37,4 +44,8 @@ struct VulkanImage
     vk::Extent2D extent;
     vk::Semaphore semaphore;
     vk::Fence submit_fence;
+    // If set, rendering is done when the counter of timeline_semaphore
+    // reaches timeline_value, and submit_fence is not signaled
+    vk::Semaphore timeline_semaphore;
+    uint64_t timeline_value;
 };
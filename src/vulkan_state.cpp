@@ -24,7 +24,9 @@
 #include "device_uuid.h"
 #include "log.h"
 
+#include <algorithm>
 #include <array>
+#include <cstring>
 #include <vector>
 #include <vulkan/vulkan.hpp>
 
@@ -41,6 +43,13 @@ VKAPI_ATTR VkBool32 VKAPI_CALL debug_callback(
     return VK_FALSE;
 }
 
+bool has_extension(std::vector<vk::ExtensionProperties> const& extensions,
+                   char const* name)
+{
+    return std::any_of(extensions.begin(), extensions.end(),
+                       [name] (auto const& ext) { return strcmp(ext.extensionName, name) == 0; });
+}
+
 class DebugUtilsDispatcher
 {
 public:
@@ -66,32 +75,51 @@ public:
 }
 
 VulkanState::VulkanState(VulkanWSI& vulkan_wsi, ChoosePhysicalDeviceStrategy const& pd_strategy, bool debug)
-    : debug_enabled(debug)
+    : has_async_compute_queue_{false},
+      has_transfer_queue_{false},
+      get_memory_properties2{nullptr},
+      memory_budget_supported{false},
+      wait_semaphores{nullptr},
+      get_semaphore_counter_value{nullptr},
+      timeline_semaphores_supported_{false},
+      debug_enabled(debug)
 {
-    create_instance(vulkan_wsi);
-    create_physical_device(vulkan_wsi, pd_strategy);
-    create_logical_device(vulkan_wsi);
+    setup_timing_.timed("instance", [&] { create_instance(vulkan_wsi); });
+    setup_timing_.timed("physical device",
+                        [&] { create_physical_device(vulkan_wsi, pd_strategy); });
+    setup_timing_.timed("logical device", [&] { create_logical_device(vulkan_wsi); });
     create_command_pool();
 }
 
 std::vector<vk::PhysicalDevice> VulkanState::available_devices(VulkanWSI& vulkan_wsi) const
 {
     auto available_devices = instance().enumeratePhysicalDevices();
-    for (auto it_device = available_devices.begin(); it_device != available_devices.end();)
+    for (auto& device : available_devices)
     {
-        if (!vulkan_wsi.is_physical_device_supported(*it_device))
+        if (!vulkan_wsi.is_physical_device_supported(device))
         {
             Log::debug("Device with uuid %s is not supported by window system integration layer\n",
-                static_cast<DeviceUUID>(it_device->getProperties().pipelineCacheUUID).representation().data());
-            it_device = available_devices.erase(it_device);
+                static_cast<DeviceUUID>(device.getProperties().pipelineCacheUUID).representation().data());
+            // Keep the positions of the other devices, for ChooseByIndexStrategy
+            device = vk::PhysicalDevice{};
         }
-        else
-            ++it_device;
     }
 
     return available_devices;
 }
 
+static std::string device_type_name(vk::PhysicalDeviceType type)
+{
+    switch (type)
+    {
+        case vk::PhysicalDeviceType::eDiscreteGpu: return "discrete";
+        case vk::PhysicalDeviceType::eIntegratedGpu: return "integrated";
+        case vk::PhysicalDeviceType::eVirtualGpu: return "virtual";
+        case vk::PhysicalDeviceType::eCpu: return "cpu";
+        default: return "other";
+    }
+}
+
 static void log_device_info(vk::PhysicalDevice const& device)
 {
     auto const props = device.getProperties();
@@ -99,6 +127,7 @@ static void log_device_info(vk::PhysicalDevice const& device)
     Log::info("    Vendor ID:      0x%X\n", props.vendorID);
     Log::info("    Device ID:      0x%X\n", props.deviceID);
     Log::info("    Device Name:    %s\n", static_cast<char const*>(props.deviceName));
+    Log::info("    Device Type:    %s\n", device_type_name(props.deviceType).c_str());
     Log::info("    Driver Version: %u\n", props.driverVersion);
     Log::info("    Device UUID:    %s\n", static_cast<DeviceUUID>(props.pipelineCacheUUID).representation().data());
 }
@@ -149,6 +178,38 @@ void VulkanState::log_all_devices()
     }
 }
 
+std::vector<DeviceDescription> VulkanState::describe_all_devices()
+{
+    auto const app_info = vk::ApplicationInfo{}
+        .setPApplicationName("vkmark")
+#ifdef VK_MAKE_API_VERSION
+        .setApiVersion(VK_MAKE_API_VERSION(0, 1, 0, 0));
+#else
+        .setApiVersion(VK_MAKE_VERSION(1, 0, 0));
+#endif
+
+    auto const create_info = vk::InstanceCreateInfo{}
+        .setPApplicationInfo(&app_info);
+
+    auto vk_instance = ManagedResource<vk::Instance>{
+        vk::createInstance(create_info),
+        [] (auto& i) { i.destroy(); }};
+
+    auto const physical_devices = vk_instance.raw.enumeratePhysicalDevices();
+    std::vector<DeviceDescription> devices;
+
+    for (uint32_t i = 0; i < physical_devices.size(); ++i)
+    {
+        auto const props = physical_devices[i].getProperties();
+        devices.push_back({i,
+                           device_type_name(props.deviceType),
+                           static_cast<char const*>(props.deviceName),
+                           static_cast<DeviceUUID>(props.pipelineCacheUUID)});
+    }
+
+    return devices;
+}
+
 void VulkanState::create_instance(VulkanWSI& vulkan_wsi)
 {
     auto const app_info = vk::ApplicationInfo{}
@@ -162,6 +223,13 @@ void VulkanState::create_instance(VulkanWSI& vulkan_wsi)
     std::vector<char const*> enabled_extensions{vulkan_wsi.required_extensions().instance};
     std::vector<char const*> validation_layers;
 
+    // Needed to query VK_EXT_memory_budget with a Vulkan 1.0 instance
+    bool const have_properties2 = has_extension(
+        vk::enumerateInstanceExtensionProperties(),
+        VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
+    if (have_properties2)
+        enabled_extensions.push_back(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
+
     bool have_debug_extensions = false;
     if (debug_enabled)
     {
@@ -190,6 +258,12 @@ void VulkanState::create_instance(VulkanWSI& vulkan_wsi)
         vk::createInstance(create_info),
         [] (auto& i) { i.destroy(); }};
 
+    if (have_properties2)
+    {
+        get_memory_properties2 = PFN_vkGetPhysicalDeviceMemoryProperties2KHR(
+            vkGetInstanceProcAddr(instance(), "vkGetPhysicalDeviceMemoryProperties2KHR"));
+    }
+
     if (have_debug_extensions)
     {
         auto const debug_create_info = vk::DebugUtilsMessengerCreateInfoEXT{}
@@ -233,6 +307,39 @@ static std::pair<uint32_t, bool> find_queue_family_index(vk::PhysicalDevice pd,
     return std::make_pair(0, false);
 }
 
+// Finds a queue family that supports compute but not graphics, which
+// usually maps to separate hardware that can run in parallel with rendering
+static std::pair<uint32_t, bool> find_compute_only_queue_family_index(vk::PhysicalDevice pd)
+{
+    auto const queue_families = pd.getQueueFamilyProperties();
+
+    for (uint32_t queue_index = 0; queue_index < queue_families.size(); ++queue_index)
+    {
+        auto const flags = queue_families[queue_index].queueFlags;
+        if ((flags & vk::QueueFlagBits::eCompute) && !(flags & vk::QueueFlagBits::eGraphics))
+            return std::make_pair(queue_index, true);
+    }
+
+    return std::make_pair(0, false);
+}
+
+// Finds a queue family that supports only transfers, which usually maps to
+// dedicated DMA hardware
+static std::pair<uint32_t, bool> find_transfer_only_queue_family_index(vk::PhysicalDevice pd)
+{
+    auto const queue_families = pd.getQueueFamilyProperties();
+    auto const non_transfer_flags = vk::QueueFlagBits::eGraphics | vk::QueueFlagBits::eCompute;
+
+    for (uint32_t queue_index = 0; queue_index < queue_families.size(); ++queue_index)
+    {
+        auto const flags = queue_families[queue_index].queueFlags;
+        if ((flags & vk::QueueFlagBits::eTransfer) && !(flags & non_transfer_flags))
+            return std::make_pair(queue_index, true);
+    }
+
+    return std::make_pair(0, false);
+}
+
 void VulkanState::create_logical_device(VulkanWSI& vulkan_wsi)
 {
     // it would be really nice to support c++17
@@ -259,6 +366,32 @@ void VulkanState::create_logical_device(VulkanWSI& vulkan_wsi)
         queue_family_indices.push_back(graphics_queue_family_index());
     }
 
+    // Graphics queues support compute too, so fall back to the graphics
+    // queue if there is no dedicated compute queue family
+    auto const compute_pair = find_compute_only_queue_family_index(physical_device());
+    has_async_compute_queue_ = compute_pair.second;
+    vk_compute_queue_family_index =
+        has_async_compute_queue_ ? compute_pair.first : graphics_queue_family_index();
+
+    if (std::find(queue_family_indices.begin(),
+                  queue_family_indices.end(),
+                  compute_queue_family_index()) == queue_family_indices.end())
+    {
+        queue_family_indices.push_back(compute_queue_family_index());
+    }
+
+    auto const transfer_pair = find_transfer_only_queue_family_index(physical_device());
+    has_transfer_queue_ = transfer_pair.second;
+    vk_transfer_queue_family_index =
+        has_transfer_queue_ ? transfer_pair.first : graphics_queue_family_index();
+
+    if (std::find(queue_family_indices.begin(),
+                  queue_family_indices.end(),
+                  transfer_queue_family_index()) == queue_family_indices.end())
+    {
+        queue_family_indices.push_back(transfer_queue_family_index());
+    }
+
     std::vector<vk::DeviceQueueCreateInfo> queue_create_infos;
     for (auto index : queue_family_indices)
     {
@@ -271,24 +404,107 @@ void VulkanState::create_logical_device(VulkanWSI& vulkan_wsi)
 
     Log::debug("VulkanState: Using queue family index %d for rendering\n",
                graphics_queue_family_index());
+    Log::debug("VulkanState: Using queue family index %d for compute%s\n",
+               compute_queue_family_index(),
+               has_async_compute_queue() ? "" : " (no dedicated compute queue)");
+    Log::debug("VulkanState: Using queue family index %d for uploads%s\n",
+               transfer_queue_family_index(),
+               has_transfer_queue() ? "" : " (no dedicated transfer queue)");
 
     std::vector<char const*> enabled_extensions{vulkan_wsi.required_extensions().device};
+    auto const device_extensions = physical_device().enumerateDeviceExtensionProperties();
+
+    // Scenes leave the images in the present layout, which is only valid
+    // with VK_KHR_swapchain, so enable it even for window systems that
+    // don't present through a swapchain
+    if (has_extension(device_extensions, VK_KHR_SWAPCHAIN_EXTENSION_NAME) &&
+        std::none_of(enabled_extensions.begin(), enabled_extensions.end(),
+                     [] (char const* ext) { return strcmp(ext, VK_KHR_SWAPCHAIN_EXTENSION_NAME) == 0; }))
+    {
+        enabled_extensions.push_back(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
+    }
+
+    memory_budget_supported =
+        get_memory_properties2 &&
+        has_extension(device_extensions, VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+    if (memory_budget_supported)
+        enabled_extensions.push_back(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+
+    // The timelineSemaphore feature is required for devices that expose
+    // the extension, so enable it whenever the extension is present
+    timeline_semaphores_supported_ =
+        has_extension(device_extensions, VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
+    if (timeline_semaphores_supported_)
+        enabled_extensions.push_back(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
+
+    VkPhysicalDeviceTimelineSemaphoreFeaturesKHR timeline_features{};
+    timeline_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR;
+    timeline_features.timelineSemaphore = VK_TRUE;
+
+    // Optional features, used only for extra measurements
+    auto const supported_features = physical_device().getFeatures();
 
-    auto const device_features = vk::PhysicalDeviceFeatures{}
-        .setSamplerAnisotropy(true);
+    vk_enabled_features = vk::PhysicalDeviceFeatures{}
+        .setSamplerAnisotropy(true)
+        .setPipelineStatisticsQuery(supported_features.pipelineStatisticsQuery);
 
     auto const device_create_info = vk::DeviceCreateInfo{}
         .setQueueCreateInfoCount(queue_create_infos.size())
         .setPQueueCreateInfos(queue_create_infos.data())
         .setEnabledExtensionCount(enabled_extensions.size())
         .setPpEnabledExtensionNames(enabled_extensions.data())
-        .setPEnabledFeatures(&device_features);
+        .setPEnabledFeatures(&vk_enabled_features)
+        .setPNext(timeline_semaphores_supported_ ? &timeline_features : nullptr);
 
     vk_device = ManagedResource<vk::Device>{
         physical_device().createDevice(device_create_info),
         [] (auto& d) { d.destroy(); }};
 
+    if (timeline_semaphores_supported_)
+    {
+        wait_semaphores = PFN_vkWaitSemaphoresKHR(
+            vkGetDeviceProcAddr(device(), "vkWaitSemaphoresKHR"));
+        get_semaphore_counter_value = PFN_vkGetSemaphoreCounterValueKHR(
+            vkGetDeviceProcAddr(device(), "vkGetSemaphoreCounterValueKHR"));
+        timeline_semaphores_supported_ = wait_semaphores && get_semaphore_counter_value;
+    }
+
+    Log::debug("VulkanState: Timeline semaphores are%s supported\n",
+               timeline_semaphores_supported() ? "" : " not");
+
     vk_graphics_queue = device().getQueue(graphics_queue_family_index(), 0);
+    vk_compute_queue = device().getQueue(compute_queue_family_index(), 0);
+    vk_transfer_queue = device().getQueue(transfer_queue_family_index(), 0);
+
+    auto const memory_properties = physical_device().getMemoryProperties();
+    std::vector<uint32_t> heap_of_type;
+    for (uint32_t i = 0; i < memory_properties.memoryTypeCount; ++i)
+        heap_of_type.push_back(memory_properties.memoryTypes[i].heapIndex);
+
+    vk_memory_tracker = std::make_unique<DeviceMemoryTracker>(
+        heap_of_type, memory_properties.memoryHeapCount);
+}
+
+std::vector<VulkanState::HeapBudget> VulkanState::memory_budget() const
+{
+    std::vector<HeapBudget> heaps;
+
+    if (!memory_budget_supported)
+        return heaps;
+
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT budget_properties{};
+    budget_properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+
+    VkPhysicalDeviceMemoryProperties2 properties{};
+    properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2;
+    properties.pNext = &budget_properties;
+
+    get_memory_properties2(physical_device(), &properties);
+
+    for (uint32_t i = 0; i < properties.memoryProperties.memoryHeapCount; ++i)
+        heaps.push_back({budget_properties.heapUsage[i], budget_properties.heapBudget[i]});
+
+    return heaps;
 }
 
 void VulkanState::create_command_pool()
@@ -309,6 +525,9 @@ vk::PhysicalDevice ChooseFirstSupportedStrategy::operator()(const std::vector<vk
 
     for (auto const& physical_device : available_devices)
     {
+        if (!physical_device)
+            continue;
+
         if (find_queue_family_index(physical_device, vk::QueueFlagBits::eGraphics).second)
         {
             Log::debug("First supported device chosen\n");
@@ -330,6 +549,9 @@ vk::PhysicalDevice ChooseByUUIDStrategy::operator()(const std::vector<vk::Physic
 
     for (auto const& physical_device: available_devices)
     {
+        if (!physical_device)
+            continue;
+
         auto&& uuid = static_cast<DeviceUUID>(physical_device.getProperties().pipelineCacheUUID);
         if (uuid == m_selected_device_uuid)
         {
@@ -341,3 +563,18 @@ vk::PhysicalDevice ChooseByUUIDStrategy::operator()(const std::vector<vk::Physic
     // if device is not supported by wsi it would appear in list_all_devices but is not available here
     throw std::runtime_error(std::string("Device specified by uuid is not available"));
 }
+
+vk::PhysicalDevice ChooseByIndexStrategy::operator()(const std::vector<vk::PhysicalDevice>& available_devices)
+{
+    Log::debug("Trying to use device with index %u\n", m_selected_device_index);
+
+    if (m_selected_device_index < available_devices.size() &&
+        available_devices[m_selected_device_index])
+    {
+        Log::debug("Device found by index\n");
+        return available_devices[m_selected_device_index];
+    }
+
+    // The device is listed by list_all_devices but not supported by the wsi
+    throw std::runtime_error(std::string("Device specified by index is not available"));
+}
@@ -23,20 +23,38 @@
 #pragma once
 
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
 #include <vulkan/vulkan.hpp>
 
 #include "managed_resource.h"
 #include "vulkan_wsi.h"
+#include "device_selector.h"
 #include "device_uuid.h"
+#include "device_memory_tracker.h"
+#include "setup_timing.h"
 
 
 class VulkanState
 {
 public:
+    struct HeapBudget
+    {
+        uint64_t usage;
+        uint64_t budget;
+    };
+
+    // Strategies get all physical devices in enumeration order, with null
+    // handles in place of the devices not supported by the window system
     using ChoosePhysicalDeviceStrategy =
         std::function<vk::PhysicalDevice (std::vector<vk::PhysicalDevice> const&)>;
 
     static void log_all_devices();
+    // The index, type, name and UUID of all physical devices, in
+    // enumeration order, whether or not they are supported by the window
+    // system
+    static std::vector<DeviceDescription> describe_all_devices();
 
     VulkanState(VulkanWSI& vulkan_wsi, ChoosePhysicalDeviceStrategy const& pd_strategy, bool debug);
 
@@ -65,11 +83,105 @@ public:
         return vk_graphics_queue;
     }
 
+    // A queue of a compute-only family if the device provides one,
+    // otherwise the graphics queue
+    uint32_t const& compute_queue_family_index() const
+    {
+        return vk_compute_queue_family_index;
+    }
+
+    vk::Queue const& compute_queue() const
+    {
+        return vk_compute_queue;
+    }
+
+    bool has_async_compute_queue() const
+    {
+        return has_async_compute_queue_;
+    }
+
+    // A queue of a transfer-only family if the device provides one,
+    // otherwise the graphics queue
+    uint32_t const& transfer_queue_family_index() const
+    {
+        return vk_transfer_queue_family_index;
+    }
+
+    vk::Queue const& transfer_queue() const
+    {
+        return vk_transfer_queue;
+    }
+
+    bool has_transfer_queue() const
+    {
+        return has_transfer_queue_;
+    }
+
+    // Must be held while submitting or presenting during benchmarks, as
+    // presentation may run on a separate thread and the queues may be the
+    // same VkQueue
+    std::mutex& queue_mutex()
+    {
+        return queue_mutex_;
+    }
+
     vk::CommandPool const& command_pool() const
     {
         return vk_command_pool;
     }
 
+    vk::PhysicalDeviceFeatures const& enabled_features() const
+    {
+        return vk_enabled_features;
+    }
+
+    DeviceMemoryTracker& memory_tracker()
+    {
+        return *vk_memory_tracker;
+    }
+
+    // Usage and budget of each memory heap as reported by
+    // VK_EXT_memory_budget, empty if the extension is not supported
+    std::vector<HeapBudget> memory_budget() const;
+
+    // Whether timeline semaphores (VK_KHR_timeline_semaphore) are enabled
+    bool timeline_semaphores_supported() const
+    {
+        return timeline_semaphores_supported_;
+    }
+
+    // Waits until the counter of a timeline semaphore reaches value,
+    // returns false on timeout. Inline, like the other accessors, so that
+    // window system plugins can use it.
+    bool wait_timeline_semaphore(vk::Semaphore const& semaphore, uint64_t value,
+                                 uint64_t timeout) const
+    {
+        VkSemaphore const raw_semaphore = semaphore;
+
+        VkSemaphoreWaitInfoKHR wait_info{};
+        wait_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR;
+        wait_info.semaphoreCount = 1;
+        wait_info.pSemaphores = &raw_semaphore;
+        wait_info.pValues = &value;
+
+        return wait_semaphores(device(), &wait_info, timeout) == VK_SUCCESS;
+    }
+
+    // Current counter value of a timeline semaphore, i.e. the value of the
+    // last signal operation the GPU has completed
+    uint64_t timeline_semaphore_value(vk::Semaphore const& semaphore) const
+    {
+        uint64_t value = 0;
+        get_semaphore_counter_value(device(), semaphore, &value);
+        return value;
+    }
+
+    // Durations of the instance, physical device and logical device creation
+    SetupTiming const& setup_timing() const
+    {
+        return setup_timing_;
+    }
+
     void log_info() const;
 
 private:
@@ -86,6 +198,21 @@ private:
     vk::Queue vk_graphics_queue;
     vk::PhysicalDevice vk_physical_device;
     uint32_t vk_graphics_queue_family_index;
+    vk::Queue vk_compute_queue;
+    uint32_t vk_compute_queue_family_index;
+    bool has_async_compute_queue_;
+    vk::Queue vk_transfer_queue;
+    uint32_t vk_transfer_queue_family_index;
+    bool has_transfer_queue_;
+    std::mutex queue_mutex_;
+    vk::PhysicalDeviceFeatures vk_enabled_features;
+    std::unique_ptr<DeviceMemoryTracker> vk_memory_tracker;
+    PFN_vkGetPhysicalDeviceMemoryProperties2KHR get_memory_properties2;
+    bool memory_budget_supported;
+    PFN_vkWaitSemaphoresKHR wait_semaphores;
+    PFN_vkGetSemaphoreCounterValueKHR get_semaphore_counter_value;
+    bool timeline_semaphores_supported_;
+    SetupTiming setup_timing_;
 
     bool debug_enabled;
     ManagedResource<vk::DebugUtilsMessengerEXT> debug_messenger;
@@ -109,3 +236,19 @@ public:
 private:
     DeviceUUID m_selected_device_uuid;
 };
+
+// Chooses the device at an enumeration index, as shown by --list-devices.
+// Unlike UUIDs, which are shared by identical devices using the same driver,
+// indices always refer to a single device.
+class ChooseByIndexStrategy
+{
+public:
+    ChooseByIndexStrategy(uint32_t index)
+        : m_selected_device_index(index)
+    {}
+
+    vk::PhysicalDevice operator()(const std::vector<vk::PhysicalDevice>& available_devices);
+
+private:
+    uint32_t m_selected_device_index;
+};
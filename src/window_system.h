@@ -42,6 +42,14 @@ public:
     virtual void present_vulkan_image(VulkanImage const&) = 0;
     virtual std::vector<VulkanImage> vulkan_images() = 0;
 
+    // The number of images that can be acquired with next_vulkan_image()
+    // before the first of them is presented, without blocking indefinitely
+    virtual uint32_t max_acquired_images() { return 1; }
+
+    // Whether the images can be copied from (i.e. they have transfer source
+    // usage), e.g. to validate or capture rendered frames
+    virtual bool supports_readback() { return false; }
+
     virtual bool should_quit() = 0;
 
 protected:
@@ -25,6 +25,7 @@
 #include "window_system_plugin.h"
 #include "options.h"
 #include "log.h"
+#include "util.h"
 
 #include <dlfcn.h>
 #include <vector>
@@ -52,6 +53,17 @@ bool has_shared_object_extension(std::string const& name)
     return string_ends_with(name, ".so");
 }
 
+std::string plugin_name_from_path(std::string const& path)
+{
+    auto const slash = path.find_last_of('/');
+    auto name = slash == std::string::npos ? path : path.substr(slash + 1);
+
+    if (has_shared_object_extension(name))
+        name.erase(name.size() - 3);
+
+    return name;
+}
+
 std::vector<std::string> files_in_dir(std::string dir)
 {
     std::vector<std::string> files;
@@ -91,15 +103,22 @@ WindowSystem& WindowSystemLoader::load_window_system()
     if (window_system)
         return *window_system;
 
-    auto const lib = options.window_system.empty() ?
-                     probe_for_best_window_system() :
-                     window_system_from_name(options.window_system);
+    auto const lib = setup_timing_.timed(
+        "window system probe",
+        [this] {
+            return options.window_system.empty() ?
+                   probe_for_best_window_system() :
+                   window_system_from_name(options.window_system);
+        });
+
+    auto const load_start = Util::get_timestamp_us();
 
     Log::debug("WindowSystemLoader: Selected window system plugin %s %s\n",
                lib.c_str(),
                !options.window_system.empty() ? "(user selection)" : "(best match)");
 
     lib_handle = LibHandle{dlopen(lib.c_str(), RTLD_LAZY), close_lib};
+    window_system_name_ = plugin_name_from_path(lib);
 
     auto const ws_create = reinterpret_cast<VkMarkWindowSystemCreateFunc>(
         dlsym(lib_handle.get(), "vkmark_window_system_create"));
@@ -112,9 +131,21 @@ WindowSystem& WindowSystemLoader::load_window_system()
     if (!window_system)
         throw std::runtime_error{"Selected window system plugin failed to create window system"};
 
+    setup_timing_.record("window system load", Util::get_timestamp_us() - load_start);
+
     return *window_system;
 }
 
+std::string WindowSystemLoader::window_system_name() const
+{
+    return window_system_name_;
+}
+
+SetupTiming const& WindowSystemLoader::setup_timing() const
+{
+    return setup_timing_;
+}
+
 std::string WindowSystemLoader::probe_for_best_window_system()
 {
     std::string best_candidate;
@@ -163,6 +194,8 @@ std::string WindowSystemLoader::probe_for_best_window_system()
 
 void WindowSystemLoader::load_window_system_options()
 {
+    auto const start = Util::get_timestamp_us();
+
     for_each_window_system(
         [&] (std::string const& name, void* handle)
         {
@@ -190,6 +223,8 @@ void WindowSystemLoader::load_window_system_options()
                 Log::debug(fmt.c_str(), dlerror());
             }
         });
+
+    setup_timing_.record("window system options", Util::get_timestamp_us() - start);
 }
 
 void WindowSystemLoader::for_each_window_system(ForeachCallback const& callback)
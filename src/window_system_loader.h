@@ -22,8 +22,11 @@
 
 #pragma once
 
+#include "setup_timing.h"
+
 #include <memory>
 #include <functional>
+#include <string>
 
 struct Options;
 class WindowSystem;
@@ -36,6 +39,11 @@ public:
 
     void load_window_system_options();
     WindowSystem& load_window_system();
+    // The name of the loaded window system plugin (e.g. "xcb")
+    std::string window_system_name() const;
+    // Durations of loading the plugin options, probing and loading the
+    // window system plugin
+    SetupTiming const& setup_timing() const;
 
 private:
     using LibHandle = std::unique_ptr<void,void(*)(void*)>;
@@ -48,4 +56,6 @@ private:
     Options& options;
     LibHandle lib_handle;
     std::unique_ptr<WindowSystem> window_system;
+    std::string window_system_name_;
+    SetupTiming setup_timing_;
 };
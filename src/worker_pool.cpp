@@ -0,0 +1,113 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "worker_pool.h"
+
+WorkerPool::WorkerPool(size_t num_workers)
+    : task{nullptr},
+      generation{0},
+      pending{0},
+      should_stop{false}
+{
+    for (size_t i = 1; i < num_workers; ++i)
+        threads.emplace_back([this, i] { worker_loop(i); });
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        should_stop = true;
+    }
+
+    start_cv.notify_all();
+
+    for (auto& thread : threads)
+        thread.join();
+}
+
+size_t WorkerPool::num_workers() const
+{
+    return threads.size() + 1;
+}
+
+void WorkerPool::run(Task const& task_)
+{
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        task = &task_;
+        pending = threads.size();
+        error = nullptr;
+        ++generation;
+    }
+
+    start_cv.notify_all();
+
+    run_task(0);
+
+    std::unique_lock<std::mutex> lock{mutex};
+    done_cv.wait(lock, [this] { return pending == 0; });
+    task = nullptr;
+
+    if (error)
+        std::rethrow_exception(error);
+}
+
+void WorkerPool::worker_loop(size_t worker)
+{
+    uint64_t last_generation = 0;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            start_cv.wait(lock,
+                [&] { return should_stop || generation != last_generation; });
+
+            if (should_stop)
+                return;
+
+            last_generation = generation;
+        }
+
+        run_task(worker);
+
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            --pending;
+        }
+
+        done_cv.notify_one();
+    }
+}
+
+void WorkerPool::run_task(size_t worker)
+{
+    try
+    {
+        (*task)(worker);
+    }
+    catch (...)
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        if (!error)
+            error = std::current_exception();
+    }
+}
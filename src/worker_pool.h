@@ -0,0 +1,61 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Runs a task on a fixed set of workers in parallel. The calling thread
+// takes part as worker 0, so a pool with a single worker runs tasks
+// synchronously without any additional threads.
+class WorkerPool
+{
+public:
+    using Task = std::function<void(size_t worker)>;
+
+    WorkerPool(size_t num_workers);
+    ~WorkerPool();
+
+    size_t num_workers() const;
+
+    // Runs the task once on each worker and waits for all of them to
+    // finish. Rethrows the first exception thrown by the task.
+    void run(Task const& task);
+
+private:
+    void worker_loop(size_t worker);
+    void run_task(size_t worker);
+
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable start_cv;
+    std::condition_variable done_cv;
+    Task const* task;
+    uint64_t generation;
+    size_t pending;
+    bool should_stop;
+    std::exception_ptr error;
+};
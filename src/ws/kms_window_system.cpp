@@ -26,6 +26,7 @@
 #include "vulkan_state.h"
 
 #include "log.h"
+#include "trace.h"
 
 #include <xf86drm.h>
 #include <drm_fourcc.h>
@@ -555,7 +556,6 @@ KMSWindowSystem::KMSWindowSystem(std::string const& drm_device,
       vt_state{tty},
       vulkan{nullptr},
       vk_image_format{vk::Format::eUndefined},
-      current_image_index{0},
       has_crtc_been_set{false},
       present_mode{present_mode},
       flipped_image_index{-1},
@@ -607,6 +607,7 @@ void KMSWindowSystem::deinit_vulkan()
     drm_fbs.clear();
     gbm_bos.clear();
     vk_submit_fences.clear();
+    acquired_image_indices.clear();
 }
 
 int32_t KMSWindowSystem::get_free_image_index()
@@ -614,7 +615,8 @@ int32_t KMSWindowSystem::get_free_image_index()
     for (int32_t i = 0; i < static_cast<int32_t>(vk_images.size()); ++i)
     {
         if (i != presented_image_index && i != flipped_image_index &&
-            i != current_image_index)
+            std::find(acquired_image_indices.begin(), acquired_image_indices.end(), i) ==
+                acquired_image_indices.end())
         {
             return i;
         }
@@ -625,10 +627,17 @@ int32_t KMSWindowSystem::get_free_image_index()
 
 VulkanImage KMSWindowSystem::next_vulkan_image()
 {
+    int32_t image_index;
+
+    while ((image_index = get_free_image_index()) < 0)
+        wait_for_drm_page_flip_event(-1);
+
+    acquired_image_indices.push_back(image_index);
+
     return {
-        static_cast<uint32_t>(current_image_index),
-        vk_images[current_image_index], vk_image_format, vk_extent, nullptr,
-        vk_submit_fences[current_image_index]
+        static_cast<uint32_t>(image_index),
+        vk_images[image_index], vk_image_format, vk_extent, nullptr,
+        vk_submit_fences[image_index]
     };
 }
 
@@ -659,10 +668,25 @@ void KMSWindowSystem::flip(uint32_t image_index)
 
 void KMSWindowSystem::present_vulkan_image(VulkanImage const& vulkan_image)
 {
-    static uint64_t const one_sec = 1000000000;
-
-    (void)vulkan->device().waitForFences(vulkan_image.submit_fence, true, one_sec);
-    vulkan->device().resetFences(vulkan_image.submit_fence);
+    // Wait without a timeout: the image is flipped right after this, so the
+    // GPU must have finished rendering to it
+    if (vulkan_image.timeline_semaphore)
+    {
+        // The submission signaled the timeline instead of the submit
+        // fence, so there is no fence to wait for and reset
+        Trace::traced("wait_submit_timeline", [&] {
+            (void)vulkan->wait_timeline_semaphore(vulkan_image.timeline_semaphore,
+                                                  vulkan_image.timeline_value,
+                                                  UINT64_MAX);
+        });
+    }
+    else
+    {
+        Trace::traced("wait_submit_fence", [&] {
+            (void)vulkan->device().waitForFences(vulkan_image.submit_fence, true, UINT64_MAX);
+        });
+        vulkan->device().resetFences(vulkan_image.submit_fence);
+    }
 
     if (present_mode == vk::PresentModeKHR::eMailbox)
     {
@@ -680,8 +704,10 @@ void KMSWindowSystem::present_vulkan_image(VulkanImage const& vulkan_image)
         flipped_image_index = vulkan_image.index;
     }
 
-    while ((current_image_index = get_free_image_index()) < 0)
-        wait_for_drm_page_flip_event(-1);
+    acquired_image_indices.erase(
+        std::remove(acquired_image_indices.begin(), acquired_image_indices.end(),
+                    static_cast<int32_t>(vulkan_image.index)),
+        acquired_image_indices.end());
 }
 
 std::vector<VulkanImage> KMSWindowSystem::vulkan_images()
@@ -694,6 +720,18 @@ std::vector<VulkanImage> KMSWindowSystem::vulkan_images()
     return vulkan_images;
 }
 
+uint32_t KMSWindowSystem::max_acquired_images()
+{
+    // One image is always kept for scanout, and the pending flip (if any)
+    // eventually completes and frees the image it replaces
+    return vk_images.size() - 1;
+}
+
+bool KMSWindowSystem::supports_readback()
+{
+    return true;
+}
+
 bool KMSWindowSystem::should_quit()
 {
     return false;
@@ -846,6 +884,7 @@ void KMSWindowSystem::create_vk_images()
                        vk::ImageTiling::eDrmFormatModifierEXT :
                        vk::ImageTiling::eOptimal)
             .setUsage(vk::ImageUsageFlagBits::eColorAttachment |
+                      vk::ImageUsageFlagBits::eTransferSrc |
                       vk::ImageUsageFlagBits::eTransferDst)
             .setSharingMode(vk::SharingMode::eExclusive)
             .setInitialLayout(vk::ImageLayout::eUndefined);
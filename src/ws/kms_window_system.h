@@ -65,6 +65,8 @@ public:
     VulkanImage next_vulkan_image() override;
     void present_vulkan_image(VulkanImage const&) override;
     std::vector<VulkanImage> vulkan_images() override;
+    uint32_t max_acquired_images() override;
+    bool supports_readback() override;
 
     bool should_quit() override;
 
@@ -100,7 +102,7 @@ protected:
     std::vector<ManagedResource<uint32_t>> drm_fbs;
     std::vector<ManagedResource<vk::Image>> vk_images;
     std::vector<ManagedResource<vk::Fence>> vk_submit_fences;
-    int32_t current_image_index;
+    std::vector<int32_t> acquired_image_indices;
     bool has_crtc_been_set;
     vk::PresentModeKHR present_mode;
     int32_t flipped_image_index;
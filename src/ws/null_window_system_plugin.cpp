@@ -0,0 +1,102 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "window_system_plugin.h"
+#include "offscreen_window_system.h"
+#include "window_system_priority.h"
+
+#include "log.h"
+#include "options.h"
+#include "util.h"
+
+namespace
+{
+
+std::string const images_opt{"null-images"};
+uint32_t const default_num_images{3};
+
+uint32_t get_num_images_option(Options const& options)
+{
+    uint32_t num_images = default_num_images;
+
+    for (auto const& opt : options.window_system_options)
+    {
+        if (opt.name == images_opt)
+        {
+            auto const value = Util::from_string<uint32_t>(opt.value);
+
+            if (value == 0)
+            {
+                Log::info("NullWindowSystemPlugin: Ignoring invalid value '%s'"
+                          " for window system option '%s'\n",
+                          opt.value.c_str(), opt.name.c_str());
+            }
+            else
+            {
+                num_images = value;
+            }
+        }
+        else
+        {
+            Log::info("NullWindowSystemPlugin: Ignoring unknown window system option '%s'\n",
+                      opt.name.c_str());
+        }
+    }
+
+    return num_images;
+}
+
+}
+
+void vkmark_window_system_load_options(Options& options)
+{
+    options.add_window_system_help(
+        "Null window system options (pass in --winsys-options)\n"
+        "  null-images=N               The number of images to render to in turn (default: 3)\n"
+        );
+}
+
+int vkmark_window_system_probe(Options const&)
+{
+    return VKMARK_WINDOW_SYSTEM_PROBE_OK + VKMARK_NULL_WINDOW_SYSTEM_PRIORITY;
+}
+
+std::unique_ptr<WindowSystem> vkmark_window_system_create(Options const& options)
+{
+    vk::Extent2D size;
+
+    if (options.size.first < 0 || options.size.second < 0)
+    {
+        Log::warning("NullWindowSystemPlugin: Ignoring invalid size, using 800x600\n");
+        size.setWidth(800);
+        size.setHeight(600);
+    }
+    else
+    {
+        size.setWidth(static_cast<uint32_t>(options.size.first));
+        size.setHeight(static_cast<uint32_t>(options.size.second));
+    }
+
+    auto const format = options.pixel_format != vk::Format::eUndefined ?
+                        options.pixel_format : vk::Format::eB8G8R8A8Srgb;
+
+    return std::make_unique<OffscreenWindowSystem>(
+        size, format, get_num_images_option(options));
+}
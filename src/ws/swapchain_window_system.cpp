@@ -26,10 +26,12 @@
 #include "vulkan_state.h"
 #include "vulkan_image.h"
 #include "log.h"
+#include "trace.h"
 
 #include <stdexcept>
 #include <algorithm>
 #include <cctype>
+#include <mutex>
 
 namespace
 {
@@ -108,7 +110,8 @@ SwapchainWindowSystem::SwapchainWindowSystem(
     : native{std::move(native)},
       vk_present_mode{present_mode},
       vk_pixel_format{pixel_format},
-      vulkan{nullptr}
+      vulkan{nullptr},
+      vk_supports_readback{false}
 {
 }
 
@@ -138,6 +141,14 @@ void SwapchainWindowSystem::init_vulkan(VulkanState& vulkan_)
     vk_swapchain = create_vk_swapchain();
     vk_images = vulkan->device().getSwapchainImagesKHR(vk_swapchain);
 
+    // The presentation engine may keep minImageCount - 1 images, so holding
+    // more acquired images than the rest may block acquisition indefinitely
+    auto const surface_min_image_count =
+        vulkan->physical_device().getSurfaceCapabilitiesKHR(vk_surface).minImageCount;
+    auto const num_images = static_cast<uint32_t>(vk_images.size());
+    vk_max_acquired_images =
+        num_images > surface_min_image_count ? num_images - surface_min_image_count + 1 : 1;
+
     Log::debug("SwapchainWindowSystem: Swapchain contains %d images\n",
                vk_images.size());
 
@@ -165,13 +176,18 @@ void SwapchainWindowSystem::deinit_vulkan()
 
 VulkanImage SwapchainWindowSystem::next_vulkan_image()
 {
-    (void)vulkan->device().waitForFences(vk_acquire_fences[current_frame].raw, true, INT64_MAX);
+    Trace::traced("wait_acquire_fence", [&] {
+        (void)vulkan->device().waitForFences(vk_acquire_fences[current_frame].raw, true, INT64_MAX);
+    });
     vulkan->device().resetFences(vk_acquire_fences[current_frame].raw);
 
     auto const image_index = vulkan->device().acquireNextImageKHR(
         vk_swapchain, UINT64_MAX, vk_acquire_semaphores[current_frame], vk_acquire_fences[current_frame]).value;
+    auto const& semaphore = vk_acquire_semaphores[current_frame];
+
+    current_frame = (current_frame + 1) % vk_acquire_semaphores.size();
 
-    return {image_index, vk_images[image_index], vk_image_format, vk_extent, vk_acquire_semaphores[current_frame], nullptr};
+    return {image_index, vk_images[image_index], vk_image_format, vk_extent, semaphore, nullptr};
 }
 
 void SwapchainWindowSystem::present_vulkan_image(VulkanImage const& vulkan_image)
@@ -183,9 +199,8 @@ void SwapchainWindowSystem::present_vulkan_image(VulkanImage const& vulkan_image
         .setWaitSemaphoreCount(vulkan_image.semaphore ? 1 : 0)
         .setPWaitSemaphores(&vulkan_image.semaphore);
 
+    std::lock_guard<std::mutex> const lock{vulkan->queue_mutex()};
     (void)vk_present_queue.presentKHR(present_info);
-
-    current_frame = (current_frame + 1) % vk_acquire_semaphores.size();
 }
 
 std::vector<VulkanImage> SwapchainWindowSystem::vulkan_images()
@@ -198,6 +213,16 @@ std::vector<VulkanImage> SwapchainWindowSystem::vulkan_images()
     return vulkan_images;
 }
 
+uint32_t SwapchainWindowSystem::max_acquired_images()
+{
+    return vk_max_acquired_images;
+}
+
+bool SwapchainWindowSystem::supports_readback()
+{
+    return vk_supports_readback;
+}
+
 bool SwapchainWindowSystem::should_quit()
 {
     return native->should_quit();
@@ -249,14 +274,21 @@ ManagedResource<vk::SwapchainKHR> SwapchainWindowSystem::create_vk_swapchain()
     if (surface_caps.maxImageCount > 0)
         min_image_count = std::min(min_image_count, surface_caps.maxImageCount);
 
+    // Allow copying from the images (e.g. for validation) when possible
+    auto image_usage = vk::ImageUsageFlags{vk::ImageUsageFlagBits::eColorAttachment |
+                                           vk::ImageUsageFlagBits::eTransferDst};
+    vk_supports_readback = static_cast<bool>(
+        surface_caps.supportedUsageFlags & vk::ImageUsageFlagBits::eTransferSrc);
+    if (vk_supports_readback)
+        image_usage |= vk::ImageUsageFlagBits::eTransferSrc;
+
     auto const swapchain_create_info = vk::SwapchainCreateInfoKHR{}
         .setSurface(vk_surface)
         .setMinImageCount(min_image_count)
         .setImageFormat(vk_image_format)
         .setImageExtent(vk_extent)
         .setImageArrayLayers(1)
-        .setImageUsage(vk::ImageUsageFlagBits::eColorAttachment |
-                       vk::ImageUsageFlagBits::eTransferDst)
+        .setImageUsage(image_usage)
         .setImageSharingMode(vk::SharingMode::eExclusive)
         .setQueueFamilyIndexCount(1)
         .setPQueueFamilyIndices(&vk_present_queue_family_index)
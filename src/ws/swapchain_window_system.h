@@ -47,6 +47,8 @@ public:
     VulkanImage next_vulkan_image() override;
     void present_vulkan_image(VulkanImage const&) override;
     std::vector<VulkanImage> vulkan_images() override;
+    uint32_t max_acquired_images() override;
+    bool supports_readback() override;
 
     bool should_quit() override;
 
@@ -74,4 +76,6 @@ private:
     vk::Format vk_image_format;
     vk::Extent2D vk_extent;
     uint32_t current_frame;
+    uint32_t vk_max_acquired_images;
+    bool vk_supports_readback;
 };
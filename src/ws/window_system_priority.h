@@ -23,6 +23,7 @@
 
 #pragma once
 
+#define VKMARK_NULL_WINDOW_SYSTEM_PRIORITY -2
 #define VKMARK_HEADLESS_WINDOW_SYSTEM_PRIORITY -1
 #define VKMARK_XCB_WINDOW_SYSTEM_PRIORITY 0
 #define VKMARK_WAYLAND_WINDOW_SYSTEM_PRIORITY 1
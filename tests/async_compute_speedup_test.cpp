@@ -0,0 +1,90 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "src/async_compute_speedup.h"
+
+#include "catch.hpp"
+
+namespace
+{
+
+BenchmarkResult test_result(std::string const& particles,
+                            std::string const& queue,
+                            unsigned int fps)
+{
+    BenchmarkResult result{};
+    result.scene = "compute";
+    result.description = "[compute] queue=" + queue;
+    result.options = {{"particles", particles}, {"queue", queue}};
+    result.fps = fps;
+    result.metrics = {{"async_compute_queue", queue == "async" ? 1.0 : 0.0}};
+    return result;
+}
+
+}
+
+SCENARIO("async compute speedup", "")
+{
+    GIVEN("Async and serial results")
+    {
+        std::vector<BenchmarkResult> const results{
+            test_result("1024", "serial", 400),
+            test_result("1024", "async", 500),
+            test_result("2048", "async", 300)};
+
+        WHEN("computing the speedup")
+        {
+            auto const entries = AsyncComputeSpeedup::compute(results);
+
+            THEN("there is an entry for each async result")
+            {
+                REQUIRE(entries.size() == 2);
+                REQUIRE(entries[0].dedicated_queue);
+            }
+
+            THEN("the speedup is relative to the serial result with equal options")
+            {
+                REQUIRE(entries[0].has_baseline);
+                REQUIRE(entries[0].serial_fps == 400);
+                REQUIRE(entries[0].speedup == 1.25);
+            }
+
+            THEN("results without a serial counterpart have no baseline")
+            {
+                REQUIRE_FALSE(entries[1].has_baseline);
+            }
+        }
+    }
+
+    GIVEN("Only serial results")
+    {
+        std::vector<BenchmarkResult> const results{test_result("1024", "serial", 400)};
+
+        WHEN("computing the speedup")
+        {
+            auto const entries = AsyncComputeSpeedup::compute(results);
+
+            THEN("there are no entries")
+            {
+                REQUIRE(entries.empty());
+            }
+        }
+    }
+}
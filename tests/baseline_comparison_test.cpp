@@ -0,0 +1,158 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "src/baseline_comparison.h"
+
+#include "catch.hpp"
+
+namespace
+{
+
+BenchmarkResult test_result(std::string const& scene,
+                            std::string const& duration,
+                            unsigned int fps)
+{
+    BenchmarkResult result{};
+    result.scene = scene;
+    result.description = "[" + scene + "]";
+    result.options = {{"duration", duration}};
+    result.fps = fps;
+    return result;
+}
+
+}
+
+SCENARIO("baseline comparison", "")
+{
+    std::vector<BenchmarkResult> const baseline{
+        test_result("clear", "1.0", 1000),
+        test_result("clear", "2.0", 1000),
+        test_result("cube", "1.0", 500)};
+
+    GIVEN("Results that are within the threshold of the baseline")
+    {
+        std::vector<BenchmarkResult> const results{
+            test_result("clear", "1.0", 960),
+            test_result("cube", "1.0", 600)};
+
+        WHEN("comparing")
+        {
+            auto const comparisons =
+                BaselineComparison::compare(baseline, results, 5.0);
+
+            THEN("the changes are calculated and no regressions are reported")
+            {
+                REQUIRE(comparisons.size() == 2);
+                REQUIRE(comparisons[0].has_baseline);
+                REQUIRE(comparisons[0].baseline_fps == 1000);
+                REQUIRE(comparisons[0].change == Approx(-4.0));
+                REQUIRE(comparisons[1].baseline_fps == 500);
+                REQUIRE(comparisons[1].change == Approx(20.0));
+                REQUIRE_FALSE(BaselineComparison::has_regressions(comparisons));
+            }
+        }
+    }
+
+    GIVEN("Results with a benchmark that dropped more than the threshold")
+    {
+        std::vector<BenchmarkResult> const results{
+            test_result("clear", "1.0", 1000),
+            test_result("clear", "2.0", 900)};
+
+        WHEN("comparing")
+        {
+            auto const comparisons =
+                BaselineComparison::compare(baseline, results, 5.0);
+
+            THEN("the benchmark is matched by options and reported as regressed")
+            {
+                REQUIRE(comparisons.size() == 2);
+                REQUIRE_FALSE(comparisons[0].regressed);
+                REQUIRE(comparisons[1].change == Approx(-10.0));
+                REQUIRE(comparisons[1].regressed);
+                REQUIRE(BaselineComparison::has_regressions(comparisons));
+                REQUIRE_FALSE(BaselineComparison::has_unmatched(comparisons));
+            }
+        }
+    }
+
+    GIVEN("Results with benchmarks missing from the baseline")
+    {
+        std::vector<BenchmarkResult> const results{
+            test_result("clear", "3.0", 10),
+            test_result("vertex", "1.0", 10)};
+
+        WHEN("comparing")
+        {
+            auto const comparisons =
+                BaselineComparison::compare(baseline, results, 5.0);
+
+            THEN("the benchmarks have no baseline and are reported as unmatched")
+            {
+                REQUIRE(comparisons.size() == 2);
+                REQUIRE_FALSE(comparisons[0].has_baseline);
+                REQUIRE_FALSE(comparisons[1].has_baseline);
+                REQUIRE_FALSE(BaselineComparison::has_regressions(comparisons));
+                REQUIRE(BaselineComparison::has_unmatched(comparisons));
+            }
+        }
+    }
+
+    GIVEN("Results with options that the baseline doesn't have")
+    {
+        auto result = test_result("clear", "2.0", 900);
+        result.options.push_back({"frames-in-flight", "2"});
+        result.options.push_back({"sync", "fence"});
+        std::vector<BenchmarkResult> const results{result};
+
+        WHEN("comparing")
+        {
+            auto const comparisons =
+                BaselineComparison::compare(baseline, results, 5.0);
+
+            THEN("the extra options are ignored when matching")
+            {
+                REQUIRE(comparisons.size() == 1);
+                REQUIRE(comparisons[0].has_baseline);
+                REQUIRE(comparisons[0].baseline_fps == 1000);
+                REQUIRE(comparisons[0].regressed);
+                REQUIRE_FALSE(BaselineComparison::has_unmatched(comparisons));
+            }
+        }
+    }
+
+    GIVEN("Results with a repeated benchmark")
+    {
+        std::vector<BenchmarkResult> const results{
+            test_result("cube", "1.0", 500),
+            test_result("cube", "1.0", 400)};
+
+        WHEN("comparing")
+        {
+            auto const comparisons =
+                BaselineComparison::compare(baseline, results, 5.0);
+
+            THEN("each baseline benchmark is matched only once")
+            {
+                REQUIRE(comparisons[0].has_baseline);
+                REQUIRE_FALSE(comparisons[1].has_baseline);
+            }
+        }
+    }
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "src/cpu_counters.h"
+#include "src/util.h"
+
+#include "catch.hpp"
+
+namespace
+{
+
+void busy_wait(uint64_t duration_us)
+{
+    auto const start = Util::get_timestamp_us();
+    while (Util::get_timestamp_us() - start < duration_us);
+}
+
+}
+
+SCENARIO("cpu counters", "")
+{
+    GIVEN("Started cpu counters")
+    {
+        CPUCounters cpu_counters;
+        cpu_counters.start();
+
+        WHEN("using the cpu and stopping the counters")
+        {
+            busy_wait(50000);
+            auto const usage = cpu_counters.stop();
+
+            THEN("the cpu time is measured")
+            {
+                REQUIRE(usage.user_ms + usage.sys_ms > 0.0);
+                REQUIRE(usage.user_ms + usage.sys_ms < 1000.0);
+            }
+
+            THEN("hardware counters are measured if available")
+            {
+                REQUIRE(usage.has_perf_counters == cpu_counters.has_perf_counters());
+                if (usage.has_perf_counters)
+                {
+                    REQUIRE(usage.instructions > 0);
+                    REQUIRE(usage.cycles > 0);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "src/device_comparison.h"
+
+#include "catch.hpp"
+
+namespace
+{
+
+BenchmarkResult test_result(std::string const& description, unsigned int fps)
+{
+    BenchmarkResult result{};
+    result.description = description;
+    result.fps = fps;
+    return result;
+}
+
+DeviceRun test_run(uint32_t index, std::vector<BenchmarkResult> const& results)
+{
+    return {{index, "discrete", "Device " + std::to_string(index), DeviceUUID{}},
+            results, 0.0};
+}
+
+}
+
+SCENARIO("device comparison", "")
+{
+    GIVEN("Runs on two devices")
+    {
+        std::vector<DeviceRun> const runs{
+            test_run(0, {test_result("[cube]", 1000),
+                         test_result("[clear]", 3000),
+                         test_result("[cube]", 1010)}),
+            test_run(1, {test_result("[cube]", 500),
+                         test_result("[texture]", 800)})};
+
+        WHEN("comparing the runs")
+        {
+            auto const rows = DeviceComparison::compute(runs);
+
+            THEN("there is a row for each distinct benchmark")
+            {
+                REQUIRE(rows.size() == 4);
+                REQUIRE(rows[0].description == "[cube]");
+                REQUIRE(rows[1].description == "[clear]");
+                REQUIRE(rows[2].description == "[cube]");
+                REQUIRE(rows[3].description == "[texture]");
+            }
+
+            THEN("the FPS of each device is in the row of the matching benchmark")
+            {
+                REQUIRE(rows[0].fps[0] == 1000u);
+                REQUIRE(rows[0].fps[1] == 500u);
+                REQUIRE(rows[2].fps[0] == 1010u);
+                REQUIRE(rows[3].fps[1] == 800u);
+            }
+
+            THEN("benchmarks missing from a device have no FPS for it")
+            {
+                REQUIRE_FALSE(rows[1].fps[1]);
+                REQUIRE_FALSE(rows[2].fps[1]);
+                REQUIRE_FALSE(rows[3].fps[0]);
+            }
+        }
+    }
+}
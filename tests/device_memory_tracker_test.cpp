@@ -0,0 +1,88 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "src/device_memory_tracker.h"
+
+#include "catch.hpp"
+
+SCENARIO("device memory tracker", "")
+{
+    GIVEN("A tracker with three memory types in two heaps")
+    {
+        DeviceMemoryTracker tracker{{0, 1, 1}, 2};
+
+        WHEN("allocating memory")
+        {
+            tracker.allocated(1, 0, 100);
+            tracker.allocated(2, 1, 200);
+            tracker.allocated(3, 2, 300);
+
+            THEN("the bytes are accounted per type and heap")
+            {
+                REQUIRE(tracker.current_bytes() == 600);
+                REQUIRE(tracker.type_bytes(0) == 100);
+                REQUIRE(tracker.type_bytes(1) == 200);
+                REQUIRE(tracker.type_bytes(2) == 300);
+                REQUIRE(tracker.heap_bytes(0) == 100);
+                REQUIRE(tracker.heap_bytes(1) == 500);
+                REQUIRE(tracker.peak_bytes() == 600);
+            }
+        }
+
+        WHEN("freeing memory")
+        {
+            tracker.allocated(1, 0, 100);
+            tracker.allocated(2, 1, 200);
+            tracker.freed(2);
+
+            THEN("the current bytes drop but the peak is kept")
+            {
+                REQUIRE(tracker.current_bytes() == 100);
+                REQUIRE(tracker.heap_bytes(1) == 0);
+                REQUIRE(tracker.peak_bytes() == 300);
+            }
+        }
+
+        WHEN("freeing an unknown allocation")
+        {
+            tracker.allocated(1, 0, 100);
+            tracker.freed(42);
+
+            THEN("nothing changes")
+            {
+                REQUIRE(tracker.current_bytes() == 100);
+            }
+        }
+
+        WHEN("resetting the peak")
+        {
+            tracker.allocated(1, 0, 100);
+            tracker.allocated(2, 1, 200);
+            tracker.freed(2);
+            tracker.reset_peak();
+            tracker.allocated(3, 2, 50);
+
+            THEN("the peak starts from the current bytes")
+            {
+                REQUIRE(tracker.peak_bytes() == 150);
+            }
+        }
+    }
+}
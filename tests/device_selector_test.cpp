@@ -0,0 +1,125 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "src/device_selector.h"
+#include "src/vulkan_state.h"
+
+#include "catch.hpp"
+
+namespace
+{
+
+std::string const uuid0{"000102030405060708090a0b0c0d0e0f"};
+std::string const uuid1{"101112131415161718191a1b1c1d1e1f"};
+
+std::vector<DeviceDescription> const devices{
+    {0, "integrated", "Intel(R) UHD Graphics 630", DeviceUUID{uuid0}},
+    {1, "discrete", "NVIDIA GeForce RTX 3080", DeviceUUID{uuid1}},
+    {2, "cpu", "llvmpipe (LLVM 15.0.7, 256 bits)", DeviceUUID{}}};
+
+std::vector<uint32_t> selected_indices(std::string const& selector)
+{
+    std::vector<uint32_t> indices;
+    for (auto const& device : DeviceSelector{selector}.select(devices))
+        indices.push_back(device.index);
+    return indices;
+}
+
+}
+
+SCENARIO("device selector", "")
+{
+    GIVEN("An empty selector")
+    {
+        THEN("all devices are selected")
+        {
+            REQUIRE(selected_indices("") == std::vector<uint32_t>{0, 1, 2});
+            REQUIRE(DeviceSelector{}.select(devices).size() == 3);
+        }
+    }
+
+    GIVEN("A UUID selector")
+    {
+        THEN("the device with the UUID is selected")
+        {
+            REQUIRE(selected_indices(uuid1) == std::vector<uint32_t>{1});
+        }
+    }
+
+    GIVEN("An index selector")
+    {
+        THEN("the device with the index is selected")
+        {
+            REQUIRE(selected_indices("2") == std::vector<uint32_t>{2});
+            REQUIRE(selected_indices("3").empty());
+        }
+    }
+
+    GIVEN("A type selector")
+    {
+        THEN("the devices of the type are selected")
+        {
+            REQUIRE(selected_indices("discrete") == std::vector<uint32_t>{1});
+            REQUIRE(selected_indices("Integrated") == std::vector<uint32_t>{0});
+            REQUIRE(selected_indices("virtual").empty());
+        }
+    }
+
+    GIVEN("A name selector")
+    {
+        THEN("the devices with a matching name are selected, ignoring case")
+        {
+            REQUIRE(selected_indices("nvidia") == std::vector<uint32_t>{1});
+            REQUIRE(selected_indices("LLVM") == std::vector<uint32_t>{2});
+            REQUIRE(selected_indices("Graphics") == std::vector<uint32_t>{0});
+            REQUIRE(selected_indices("radeon").empty());
+        }
+    }
+
+    GIVEN("Two identical devices sharing a pipeline cache UUID")
+    {
+        std::vector<DeviceDescription> const identical{
+            {0, "discrete", "AMD Radeon RX 7900 XTX", DeviceUUID{uuid1}},
+            {1, "discrete", "AMD Radeon RX 7900 XTX", DeviceUUID{uuid1}}};
+
+        // Fake handles, which the strategy only compares
+        auto const pd0 = vk::PhysicalDevice{reinterpret_cast<VkPhysicalDevice>(uintptr_t{0x10})};
+        auto const pd1 = vk::PhysicalDevice{reinterpret_cast<VkPhysicalDevice>(uintptr_t{0x20})};
+        std::vector<vk::PhysicalDevice> const physical_devices{pd0, pd1};
+
+        THEN("each selected device is chosen by its own index")
+        {
+            auto const selected = DeviceSelector{}.select(identical);
+
+            REQUIRE(selected.size() == 2);
+            REQUIRE(ChooseByIndexStrategy{selected[0].index}(physical_devices) == pd0);
+            REQUIRE(ChooseByIndexStrategy{selected[1].index}(physical_devices) == pd1);
+        }
+
+        THEN("a device not supported by the window system isn't chosen")
+        {
+            std::vector<vk::PhysicalDevice> const second_only{vk::PhysicalDevice{}, pd1};
+
+            REQUIRE_THROWS(ChooseByIndexStrategy{0}(second_only));
+            REQUIRE(ChooseByIndexStrategy{1}(second_only) == pd1);
+            REQUIRE_THROWS(ChooseByIndexStrategy{2}(second_only));
+        }
+    }
+}
@@ -0,0 +1,140 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "src/energy_sampler.h"
+#include "src/util.h"
+
+#include "catch.hpp"
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+
+fs::path create_temp_dir()
+{
+    std::string tmpl = (fs::temp_directory_path() / "vkmark-sysfs-XXXXXX").string();
+    if (!mkdtemp(tmpl.data()))
+        throw std::runtime_error{"Failed to create temporary directory"};
+    return tmpl;
+}
+
+void write_value(fs::path const& path, uint64_t value)
+{
+    fs::create_directories(path.parent_path());
+    std::ofstream{path} << value << "\n";
+}
+
+}
+
+SCENARIO("energy sampler", "")
+{
+    auto const root = create_temp_dir();
+    auto const root_cleanup = Util::on_scope_exit([&] { fs::remove_all(root); });
+    std::chrono::milliseconds const interval{1};
+
+    GIVEN("A sysfs tree without energy counters")
+    {
+        fs::create_directories(root / "class/hwmon/hwmon0");
+        write_value(root / "class/hwmon/hwmon0/temp1_input", 40000);
+
+        EnergySampler sampler{root.string(), interval};
+
+        THEN("no sources are found")
+        {
+            REQUIRE_FALSE(sampler.has_sources());
+        }
+    }
+
+    GIVEN("A sysfs tree with RAPL zones and subzones")
+    {
+        auto const zone = root / "class/powercap/intel-rapl:0";
+        write_value(zone / "energy_uj", 1000000);
+        write_value(zone / "max_energy_range_uj", 10000000);
+        write_value(root / "class/powercap/intel-rapl:0:0/energy_uj", 500000);
+
+        EnergySampler sampler{root.string(), interval};
+
+        THEN("only the top-level zones are used")
+        {
+            REQUIRE(sampler.source_paths() ==
+                    std::vector<std::string>{(zone / "energy_uj").string()});
+        }
+
+        WHEN("the energy counter increases during sampling")
+        {
+            sampler.start();
+            write_value(zone / "energy_uj", 3500000);
+            auto const energy = sampler.stop();
+
+            THEN("the energy difference is measured")
+            {
+                REQUIRE(energy.joules == Approx(2.5));
+                REQUIRE(energy.seconds > 0.0);
+            }
+        }
+
+        WHEN("the energy counter wraps around during sampling")
+        {
+            write_value(zone / "energy_uj", 9000000);
+            sampler.start();
+            write_value(zone / "energy_uj", 1000000);
+            auto const energy = sampler.stop();
+
+            THEN("the wrap around is taken into account")
+            {
+                REQUIRE(energy.joules == Approx(2.0));
+            }
+        }
+    }
+
+    GIVEN("A sysfs tree with hwmon energy and power inputs")
+    {
+        write_value(root / "class/hwmon/hwmon0/energy1_input", 2000000);
+        write_value(root / "class/hwmon/hwmon0/power1_input", 5000000);
+        write_value(root / "class/hwmon/hwmon1/power1_input", 5000000);
+
+        EnergySampler sampler{root.string(), interval};
+
+        THEN("energy inputs are preferred over power inputs of the same device")
+        {
+            REQUIRE(sampler.source_paths() ==
+                    std::vector<std::string>{
+                        (root / "class/hwmon/hwmon0/energy1_input").string(),
+                        (root / "class/hwmon/hwmon1/power1_input").string()});
+        }
+
+        WHEN("sampling")
+        {
+            sampler.start();
+            write_value(root / "class/hwmon/hwmon0/energy1_input", 3000000);
+            auto const energy = sampler.stop();
+
+            THEN("the energy and the integrated power are summed")
+            {
+                // The constant 5 W power is integrated over the elapsed time
+                REQUIRE(energy.joules == Approx(1.0 + 5.0 * energy.seconds));
+            }
+        }
+    }
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "src/frame_progress.h"
+
+#include "catch.hpp"
+
+SCENARIO("frame progress", "")
+{
+    FrameProgress progress;
+
+    GIVEN("Submitted frames")
+    {
+        progress.submitted(1, 1000);
+        progress.submitted(2, 2000);
+        progress.submitted(3, 3000);
+
+        THEN("all frames are pending")
+        {
+            REQUIRE(progress.pending() == 3);
+            REQUIRE(progress.latency_stats().count() == 0);
+        }
+
+        WHEN("some frames complete")
+        {
+            progress.completed(2, 5000);
+
+            THEN("the latency of the completed frames is recorded")
+            {
+                REQUIRE(progress.pending() == 1);
+                REQUIRE(progress.latency_stats().count() == 2);
+                REQUIRE(progress.latency_stats().mean() == 3.5);
+                REQUIRE(progress.pending_stats().count() == 1);
+                REQUIRE(progress.pending_stats().mean() == 1.0);
+            }
+        }
+
+        WHEN("no new frames complete")
+        {
+            progress.completed(0, 5000);
+
+            THEN("only the number of pending frames is recorded")
+            {
+                REQUIRE(progress.pending() == 3);
+                REQUIRE(progress.latency_stats().count() == 0);
+                REQUIRE(progress.pending_stats().mean() == 3.0);
+            }
+        }
+
+        WHEN("resetting the stats")
+        {
+            progress.completed(1, 2000);
+            progress.reset_stats();
+            progress.completed(3, 4000);
+
+            THEN("the pending frames are still tracked")
+            {
+                REQUIRE(progress.pending() == 0);
+                REQUIRE(progress.latency_stats().count() == 2);
+                REQUIRE(progress.latency_stats().mean() == 1.5);
+                REQUIRE(progress.pending_stats().count() == 1);
+                REQUIRE(progress.pending_stats().mean() == 0.0);
+            }
+        }
+    }
+}
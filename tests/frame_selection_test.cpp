@@ -0,0 +1,80 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "src/frame_selection.h"
+
+#include "catch.hpp"
+
+SCENARIO("frame selection", "")
+{
+    GIVEN("A default constructed selection")
+    {
+        FrameSelection const selection;
+
+        THEN("no frames are selected")
+        {
+            REQUIRE(selection.empty());
+            REQUIRE_FALSE(selection.contains(1));
+        }
+    }
+
+    GIVEN("The 'all' selection")
+    {
+        FrameSelection const selection{"all"};
+
+        THEN("all frames are selected")
+        {
+            REQUIRE_FALSE(selection.empty());
+            REQUIRE(selection.contains(1));
+            REQUIRE(selection.contains(123456));
+        }
+    }
+
+    GIVEN("A list of frames and ranges")
+    {
+        FrameSelection const selection{"1,10-12,100"};
+
+        THEN("only the listed frames are selected")
+        {
+            REQUIRE(selection.contains(1));
+            REQUIRE_FALSE(selection.contains(2));
+            REQUIRE_FALSE(selection.contains(9));
+            REQUIRE(selection.contains(10));
+            REQUIRE(selection.contains(11));
+            REQUIRE(selection.contains(12));
+            REQUIRE_FALSE(selection.contains(13));
+            REQUIRE(selection.contains(100));
+        }
+    }
+
+    GIVEN("Invalid selections")
+    {
+        THEN("an exception is thrown")
+        {
+            REQUIRE_THROWS(FrameSelection{""});
+            REQUIRE_THROWS(FrameSelection{"0"});
+            REQUIRE_THROWS(FrameSelection{"1,"});
+            REQUIRE_THROWS(FrameSelection{"5-2"});
+            REQUIRE_THROWS(FrameSelection{"1-2-3"});
+            REQUIRE_THROWS(FrameSelection{"-3"});
+            REQUIRE_THROWS(FrameSelection{"x"});
+        }
+    }
+}
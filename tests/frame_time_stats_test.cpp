@@ -0,0 +1,97 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "src/frame_time_stats.h"
+
+#include "catch.hpp"
+
+SCENARIO("frame time stats", "")
+{
+    FrameTimeStats stats;
+
+    GIVEN("No recorded frame times")
+    {
+        THEN("all statistics are zero")
+        {
+            REQUIRE(stats.count() == 0);
+            REQUIRE(stats.min() == 0);
+            REQUIRE(stats.max() == 0);
+            REQUIRE(stats.mean() == 0.0);
+            REQUIRE(stats.stddev() == 0.0);
+            REQUIRE(stats.percentile(50.0) == 0.0);
+        }
+    }
+
+    GIVEN("Some recorded small frame times")
+    {
+        for (uint64_t i = 1; i <= 100; ++i)
+            stats.record(i);
+
+        THEN("the basic statistics are exact")
+        {
+            REQUIRE(stats.count() == 100);
+            REQUIRE(stats.min() == 1);
+            REQUIRE(stats.max() == 100);
+            REQUIRE(stats.mean() == Approx(50.5));
+            REQUIRE(stats.stddev() == Approx(29.0115));
+        }
+
+        THEN("the percentiles are exact")
+        {
+            REQUIRE(stats.percentile(0.0) == 1.0);
+            REQUIRE(stats.percentile(50.0) == 50.0);
+            REQUIRE(stats.percentile(90.0) == 90.0);
+            REQUIRE(stats.percentile(99.0) == 99.0);
+            REQUIRE(stats.percentile(99.9) == 100.0);
+            REQUIRE(stats.percentile(100.0) == 100.0);
+        }
+
+        WHEN("resetting the stats")
+        {
+            stats.reset();
+
+            THEN("the recorded frame times are discarded")
+            {
+                REQUIRE(stats.count() == 0);
+                REQUIRE(stats.percentile(50.0) == 0.0);
+            }
+        }
+    }
+
+    GIVEN("Some recorded large frame times with a few outliers")
+    {
+        for (int i = 0; i < 990; ++i)
+            stats.record(16667);
+        for (int i = 0; i < 10; ++i)
+            stats.record(100000);
+
+        THEN("the percentiles are within 1% of the recorded values")
+        {
+            REQUIRE(stats.percentile(50.0) == Approx(16667).epsilon(0.01));
+            REQUIRE(stats.percentile(99.0) == Approx(16667).epsilon(0.01));
+            REQUIRE(stats.percentile(99.9) == Approx(100000).epsilon(0.01));
+        }
+
+        THEN("the min and max are exact")
+        {
+            REQUIRE(stats.min() == 16667);
+            REQUIRE(stats.max() == 100000);
+        }
+    }
+}
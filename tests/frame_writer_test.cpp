@@ -0,0 +1,145 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "src/frame_writer.h"
+#include "src/util.h"
+
+#include "catch.hpp"
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+
+fs::path create_temp_dir()
+{
+    std::string tmpl = (fs::temp_directory_path() / "vkmark-capture-XXXXXX").string();
+    if (!mkdtemp(tmpl.data()))
+        throw std::runtime_error{"Failed to create temporary directory"};
+    return tmpl;
+}
+
+std::vector<unsigned char> solid_image(size_t width, size_t height,
+                                       unsigned char r, unsigned char g, unsigned char b)
+{
+    std::vector<unsigned char> rgba;
+
+    for (size_t i = 0; i < width * height; ++i)
+        rgba.insert(rgba.end(), {r, g, b, 255});
+
+    return rgba;
+}
+
+std::string read_file(fs::path const& path)
+{
+    std::ifstream ifs{path, std::ios::binary};
+    return {std::istreambuf_iterator<char>{ifs}, std::istreambuf_iterator<char>{}};
+}
+
+}
+
+SCENARIO("frame writer", "")
+{
+    auto const dir = create_temp_dir();
+    auto const dir_cleanup = Util::on_scope_exit([&] { fs::remove_all(dir); });
+    auto const stem = (dir / "cube").string();
+
+    GIVEN("A writer of PNG files with a short queue")
+    {
+        FrameWriter writer{CaptureFormat::png, 1};
+
+        WHEN("writing more frames than fit in the queue and flushing")
+        {
+            for (uint64_t frame = 1; frame <= 5; ++frame)
+                writer.write(stem, frame, 4, 2, solid_image(4, 2, 10 * frame, 0, 0));
+            writer.flush();
+
+            THEN("all frames are written to separate files")
+            {
+                REQUIRE(writer.frames_written() == 5);
+
+                for (uint64_t frame = 1; frame <= 5; ++frame)
+                {
+                    auto const image = Util::load_image_file(
+                        stem + "-frame" + std::to_string(frame) + ".png");
+                    REQUIRE(image.width == 4);
+                    REQUIRE(image.height == 2);
+                    REQUIRE(image.data[0] == 10 * frame);
+                }
+            }
+        }
+    }
+
+    GIVEN("A writer of Y4M files")
+    {
+        FrameWriter writer{CaptureFormat::y4m, 8};
+
+        WHEN("writing frames of two benchmarks")
+        {
+            writer.write(stem, 1, 4, 2, solid_image(4, 2, 255, 255, 255));
+            writer.write(stem, 2, 4, 2, solid_image(4, 2, 0, 0, 0));
+            writer.write(stem + "2", 1, 2, 2, solid_image(2, 2, 255, 0, 0));
+            writer.flush();
+
+            THEN("the frames of each benchmark are written to a video file")
+            {
+                std::string const header{"YUV4MPEG2 W4 H2 F60:1 Ip A1:1 C444 XCOLORRANGE=FULL\n"};
+                auto const video = read_file(stem + ".y4m");
+
+                REQUIRE(video.size() == header.size() + 2 * (6 + 3 * 8));
+                REQUIRE(video.compare(0, header.size(), header) == 0);
+                REQUIRE(video.compare(header.size(), 6, "FRAME\n") == 0);
+
+                // White is full luma and neutral chroma, black is zero luma
+                auto const frame1 = header.size() + 6;
+                auto const frame2 = frame1 + 3 * 8 + 6;
+                REQUIRE(static_cast<unsigned char>(video[frame1]) == 255);
+                REQUIRE(static_cast<unsigned char>(video[frame1 + 8]) == 128);
+                REQUIRE(static_cast<unsigned char>(video[frame1 + 16]) == 128);
+                REQUIRE(static_cast<unsigned char>(video[frame2]) == 0);
+
+                auto const video2 = read_file(stem + "2.y4m");
+                REQUIRE(video2.compare(0, 23, "YUV4MPEG2 W2 H2 F60:1 I") == 0);
+            }
+        }
+    }
+
+    GIVEN("A writer to a directory that doesn't exist")
+    {
+        FrameWriter writer{CaptureFormat::png, 8};
+
+        WHEN("writing a frame and flushing")
+        {
+            writer.write((dir / "missing" / "cube").string(), 1, 1, 1, solid_image(1, 1, 0, 0, 0));
+
+            THEN("the error is thrown by flush")
+            {
+                REQUIRE_THROWS(writer.flush());
+                REQUIRE(writer.frames_written() == 0);
+                REQUIRE_NOTHROW(writer.flush());
+            }
+        }
+    }
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "src/host_memory.h"
+
+#include "catch.hpp"
+
+#include <fstream>
+#include <cstdlib>
+#include <unistd.h>
+
+SCENARIO("host memory", "")
+{
+    GIVEN("A status file")
+    {
+        char status_file[] = "/tmp/vkmark-status-XXXXXX";
+        auto const fd = mkstemp(status_file);
+        REQUIRE(fd >= 0);
+        close(fd);
+
+        std::ofstream{status_file} << "Name:\tvkmark\n"
+                                   << "VmHWM:\t    2048 kB\n"
+                                   << "VmRSS:\t    1024 kB\n";
+
+        WHEN("reading fields")
+        {
+            THEN("values are converted to bytes")
+            {
+                REQUIRE(HostMemory::status_field_bytes(status_file, "VmRSS") == 1024 * 1024);
+                REQUIRE(HostMemory::status_field_bytes(status_file, "VmHWM") == 2048 * 1024);
+            }
+        }
+
+        WHEN("reading a missing field")
+        {
+            THEN("zero is returned")
+            {
+                REQUIRE(HostMemory::status_field_bytes(status_file, "VmSwap") == 0);
+            }
+        }
+
+        unlink(status_file);
+    }
+
+    GIVEN("The running process")
+    {
+        THEN("the peak RSS is not lower than the current RSS")
+        {
+            auto const current = HostMemory::current_rss();
+            REQUIRE(current > 0);
+            REQUIRE(HostMemory::peak_rss() >= current);
+        }
+    }
+}
@@ -0,0 +1,188 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "src/image_validation.h"
+#include "src/util.h"
+
+#include "catch.hpp"
+
+#include <cstdlib>
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+
+fs::path create_temp_dir()
+{
+    std::string tmpl = (fs::temp_directory_path() / "vkmark-validate-XXXXXX").string();
+    if (!mkdtemp(tmpl.data()))
+        throw std::runtime_error{"Failed to create temporary directory"};
+    return tmpl;
+}
+
+std::vector<unsigned char> gradient_image(size_t width, size_t height)
+{
+    std::vector<unsigned char> rgba(4 * width * height);
+
+    for (size_t i = 0; i < width * height; ++i)
+    {
+        rgba[4 * i] = i % 256;
+        rgba[4 * i + 1] = (i / width) % 256;
+        rgba[4 * i + 2] = 128;
+        rgba[4 * i + 3] = 255;
+    }
+
+    return rgba;
+}
+
+}
+
+SCENARIO("image validation", "")
+{
+    auto const dir = create_temp_dir();
+    auto const dir_cleanup = Util::on_scope_exit([&] { fs::remove_all(dir); });
+
+    // Large enough for the PNG data to span multiple deflate blocks
+    size_t const width = 200;
+    size_t const height = 100;
+    auto const image = gradient_image(width, height);
+    auto const path = (dir / "ref.png").string();
+
+    GIVEN("Two images that differ only in alpha")
+    {
+        auto other = image;
+        other[3] = 0;
+
+        THEN("their hashes are equal")
+        {
+            REQUIRE(ImageValidation::hash(image.data(), width, height) ==
+                    ImageValidation::hash(other.data(), width, height));
+        }
+    }
+
+    GIVEN("Two images that differ in a color channel")
+    {
+        auto other = image;
+        other[1] ^= 1;
+
+        THEN("their hashes differ")
+        {
+            REQUIRE(ImageValidation::hash(image.data(), width, height) !=
+                    ImageValidation::hash(other.data(), width, height));
+            REQUIRE(ImageValidation::hash_string(0xabc) == "0000000000000abc");
+        }
+    }
+
+    GIVEN("Benchmark descriptions")
+    {
+        THEN("file names without special characters are derived")
+        {
+            REQUIRE(ImageValidation::reference_file_name("[cube] <default>", 10) ==
+                    "cube-frame10.png");
+            REQUIRE(ImageValidation::reference_file_name(
+                        "[clear] color=1,0,0:present=thread", 5) ==
+                    "clear_color=1,0,0_present=thread-frame5.png");
+            REQUIRE(ImageValidation::reference_file_name(
+                        "[texture] texture-filter=linear:model=../x/y", 1) ==
+                    "texture_texture-filter=linear_model=.._x_y-frame1.png");
+        }
+    }
+
+    GIVEN("No reference image")
+    {
+        auto const result = ImageValidation::validate(
+            image.data(), width, height, path, 0);
+
+        THEN("the image is written as the reference and is valid")
+        {
+            REQUIRE(result.reference_written);
+            REQUIRE(result.valid);
+            REQUIRE(fs::exists(path));
+
+            auto const reference = Util::load_image_file(path);
+            REQUIRE(reference.width == width);
+            REQUIRE(reference.height == height);
+            REQUIRE(std::equal(image.begin(), image.end(), reference.data));
+        }
+
+        WHEN("validating the same image")
+        {
+            auto const again = ImageValidation::validate(
+                image.data(), width, height, path, 0);
+
+            THEN("it matches the reference")
+            {
+                REQUIRE_FALSE(again.reference_written);
+                REQUIRE(again.valid);
+                REQUIRE(again.hash == result.hash);
+                REQUIRE(again.mismatched_pixels == 0);
+            }
+        }
+
+        WHEN("validating an image with small differences")
+        {
+            auto other = image;
+            other[0] += 2;
+            other[4 * 50 + 2] -= 2;
+
+            auto const within = ImageValidation::validate(
+                other.data(), width, height, path, 2);
+            auto const outside = ImageValidation::validate(
+                other.data(), width, height, path, 1);
+
+            THEN("it matches only within the tolerance")
+            {
+                REQUIRE(within.valid);
+                REQUIRE(within.max_difference == 2);
+                REQUIRE_FALSE(outside.valid);
+                REQUIRE(outside.mismatched_pixels == 2);
+            }
+        }
+
+        WHEN("validating an image of a different size")
+        {
+            auto const smaller = ImageValidation::validate(
+                image.data(), width, height / 2, path, 255);
+
+            THEN("it doesn't match")
+            {
+                REQUIRE_FALSE(smaller.valid);
+                REQUIRE(smaller.mismatched_pixels == width * height / 2);
+            }
+        }
+    }
+
+    GIVEN("Benchmark results with and without validation")
+    {
+        std::vector<BenchmarkResult> results(3, BenchmarkResult{});
+        results[1].has_validation = true;
+        results[1].valid = true;
+
+        THEN("failures are detected only for invalid results")
+        {
+            REQUIRE_FALSE(ImageValidation::has_failures(results));
+
+            results[2].has_validation = true;
+            REQUIRE(ImageValidation::has_failures(results));
+        }
+    }
+}
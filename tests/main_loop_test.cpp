@@ -215,6 +215,19 @@ SCENARIO("main loop run", "")
                 REQUIRE_THAT(log, Equals(expected));
             }
 
+            THEN("a result is recorded for each benchmark")
+            {
+                auto const& results = main_loop.results();
+
+                REQUIRE(results.size() == benchmarks.size());
+                for (size_t i = 0; i < results.size(); ++i)
+                {
+                    REQUIRE(results[i].scene == benchmarks[i]);
+                    REQUIRE(results[i].fps == SingleFrameScene::fps(i + 1));
+                    REQUIRE(results[i].frames == 1);
+                }
+            }
+
             THEN("the score is calculated as the average fps of the benchmarks")
             {
                 auto const expected =
@@ -181,6 +181,168 @@ SCENARIO("options parses command line arguments", "")
         }
     }
 
+    GIVEN("A command line with --results-file and --results-format")
+    {
+        std::string const results_file{"bla/results.csv"};
+        std::vector<std::string> args{
+            "vkmark", "--results-file", results_file, "--results-format", "csv"};
+        auto argv = argv_from_vector(args);
+
+        WHEN("parsing the args")
+        {
+            REQUIRE(options.results_file.empty());
+            REQUIRE(options.results_format == "json");
+            REQUIRE(options.parse_args(args.size(), argv.get()));
+
+            THEN("the results options are parsed")
+            {
+                REQUIRE(options.results_file == results_file);
+                REQUIRE(options.results_format == "csv");
+            }
+        }
+    }
+
+    GIVEN("A command line with an invalid --results-format")
+    {
+        std::vector<std::string> args{"vkmark", "--results-format", "xml"};
+        auto argv = argv_from_vector(args);
+
+        WHEN("parsing the args")
+        {
+            THEN("the parsing fails")
+            {
+                REQUIRE_THROWS(options.parse_args(args.size(), argv.get()));
+            }
+        }
+    }
+
+    GIVEN("A command line with --compare-to and --regression-threshold")
+    {
+        std::string const baseline{"bla/baseline.json"};
+        std::vector<std::string> args{
+            "vkmark", "--compare-to", baseline, "--regression-threshold", "2.5"};
+        auto argv = argv_from_vector(args);
+
+        WHEN("parsing the args")
+        {
+            REQUIRE(options.compare_to.empty());
+            REQUIRE(options.regression_threshold == 5.0);
+            REQUIRE(options.parse_args(args.size(), argv.get()));
+
+            THEN("the comparison options are parsed")
+            {
+                REQUIRE(options.compare_to == baseline);
+                REQUIRE(options.regression_threshold == 2.5);
+            }
+        }
+    }
+
+    GIVEN("A command line with --score-method and --score-reference")
+    {
+        std::string const reference{"bla/reference.json"};
+        std::vector<std::string> args{
+            "vkmark", "--score-method", "reference", "--score-reference", reference};
+        auto argv = argv_from_vector(args);
+
+        WHEN("parsing the args")
+        {
+            REQUIRE(options.score_method == ScoreMethod::fps);
+            REQUIRE(options.parse_args(args.size(), argv.get()));
+
+            THEN("the score options are parsed")
+            {
+                REQUIRE(options.score_method == ScoreMethod::reference);
+                REQUIRE(options.score_reference == reference);
+            }
+        }
+    }
+
+    GIVEN("A command line with an invalid --score-method")
+    {
+        std::vector<std::string> args{"vkmark", "--score-method", "median"};
+        auto argv = argv_from_vector(args);
+
+        WHEN("parsing the args")
+        {
+            THEN("the parsing fails")
+            {
+                REQUIRE_THROWS(options.parse_args(args.size(), argv.get()));
+            }
+        }
+    }
+
+    GIVEN("A command line with --sample-energy and --sysfs-root")
+    {
+        std::string const sysfs_root{"bla/sys"};
+        std::vector<std::string> args{
+            "vkmark", "--sample-energy", "--sysfs-root", sysfs_root};
+        auto argv = argv_from_vector(args);
+
+        WHEN("parsing the args")
+        {
+            REQUIRE_FALSE(options.sample_energy);
+            REQUIRE(options.sysfs_root == "/sys");
+            REQUIRE(options.parse_args(args.size(), argv.get()));
+
+            THEN("the energy sampling options are parsed")
+            {
+                REQUIRE(options.sample_energy);
+                REQUIRE(options.sysfs_root == sysfs_root);
+            }
+        }
+    }
+
+    GIVEN("A command line with --cpu-counters")
+    {
+        std::vector<std::string> args{"vkmark", "--cpu-counters"};
+        auto argv = argv_from_vector(args);
+
+        WHEN("parsing the args")
+        {
+            REQUIRE_FALSE(options.cpu_counters);
+            REQUIRE(options.parse_args(args.size(), argv.get()));
+
+            THEN("cpu counters are enabled")
+            {
+                REQUIRE(options.cpu_counters);
+            }
+        }
+    }
+
+    GIVEN("A command line with --memory-stats")
+    {
+        std::vector<std::string> args{"vkmark", "--memory-stats"};
+        auto argv = argv_from_vector(args);
+
+        WHEN("parsing the args")
+        {
+            REQUIRE_FALSE(options.memory_stats);
+            REQUIRE(options.parse_args(args.size(), argv.get()));
+
+            THEN("memory stats are enabled")
+            {
+                REQUIRE(options.memory_stats);
+            }
+        }
+    }
+
+    GIVEN("A command line with --setup-times")
+    {
+        std::vector<std::string> args{"vkmark", "--setup-times"};
+        auto argv = argv_from_vector(args);
+
+        WHEN("parsing the args")
+        {
+            REQUIRE_FALSE(options.setup_times);
+            REQUIRE(options.parse_args(args.size(), argv.get()));
+
+            THEN("setup times are enabled")
+            {
+                REQUIRE(options.setup_times);
+            }
+        }
+    }
+
     GIVEN("A command line with --list-scenes")
     {
         std::vector<std::string> args{"vkmark", "--list-scenes"};
@@ -373,6 +535,142 @@ SCENARIO("options parses command line arguments", "")
         }
     }
 
+    GIVEN("A command line with --all-devices and a device type")
+    {
+        std::vector<std::string> args{"vkmark", "--all-devices", "-D", "discrete"};
+        auto argv = argv_from_vector(args);
+
+        WHEN("parsing the args")
+        {
+            REQUIRE_FALSE(options.all_devices);
+            REQUIRE(options.parse_args(args.size(), argv.get()));
+
+            THEN("the device options are parsed")
+            {
+                REQUIRE(options.all_devices);
+                REQUIRE(options.use_device == "discrete");
+                REQUIRE_FALSE(options.use_device_with_uuid);
+            }
+        }
+    }
+
+    GIVEN("A command line with --tenants")
+    {
+        std::vector<std::string> args{"vkmark", "--tenants", "4"};
+        auto argv = argv_from_vector(args);
+
+        WHEN("parsing the args")
+        {
+            REQUIRE(options.tenants == 1);
+            REQUIRE(options.parse_args(args.size(), argv.get()));
+
+            THEN("the number of tenants is parsed")
+            {
+                REQUIRE(options.tenants == 4);
+            }
+        }
+    }
+
+    GIVEN("A command line with zero tenants")
+    {
+        std::vector<std::string> args{"vkmark", "--tenants", "0"};
+        auto argv = argv_from_vector(args);
+
+        THEN("parsing the args fails")
+        {
+            REQUIRE_THROWS(options.parse_args(args.size(), argv.get()));
+        }
+    }
+
+    GIVEN("A command line with --validate options")
+    {
+        std::vector<std::string> args{
+            "vkmark", "--validate", "refs", "--validate-frame", "20",
+            "--validate-tolerance", "0"};
+        auto argv = argv_from_vector(args);
+
+        WHEN("parsing the args")
+        {
+            REQUIRE(options.validate_dir.empty());
+            REQUIRE(options.validate_frame == 10);
+            REQUIRE(options.validate_tolerance == 2);
+            REQUIRE(options.parse_args(args.size(), argv.get()));
+
+            THEN("the validation options are parsed")
+            {
+                REQUIRE(options.validate_dir == "refs");
+                REQUIRE(options.validate_frame == 20);
+                REQUIRE(options.validate_tolerance == 0);
+            }
+        }
+    }
+
+    GIVEN("A command line with an out of range validation tolerance")
+    {
+        std::vector<std::string> args{"vkmark", "--validate-tolerance", "256"};
+        auto argv = argv_from_vector(args);
+
+        THEN("parsing the args fails")
+        {
+            REQUIRE_THROWS(options.parse_args(args.size(), argv.get()));
+        }
+    }
+
+    GIVEN("A command line with --capture options")
+    {
+        std::vector<std::string> args{
+            "vkmark", "--capture-frames", "1,5-6", "--capture-format", "y4m",
+            "--capture-dir", "frames"};
+        auto argv = argv_from_vector(args);
+
+        WHEN("parsing the args")
+        {
+            REQUIRE(options.capture_frames.empty());
+            REQUIRE(options.capture_format == CaptureFormat::png);
+            REQUIRE(options.parse_args(args.size(), argv.get()));
+
+            THEN("the capture options are parsed")
+            {
+                REQUIRE(options.capture_frames.contains(1));
+                REQUIRE_FALSE(options.capture_frames.contains(2));
+                REQUIRE(options.capture_frames.contains(6));
+                REQUIRE(options.capture_format == CaptureFormat::y4m);
+                REQUIRE(options.capture_dir == "frames");
+            }
+        }
+    }
+
+    GIVEN("A command line with an invalid capture format")
+    {
+        std::vector<std::string> args{"vkmark", "--capture-format", "gif"};
+        auto argv = argv_from_vector(args);
+
+        THEN("parsing the args fails")
+        {
+            REQUIRE_THROWS(options.parse_args(args.size(), argv.get()));
+        }
+    }
+
+    GIVEN("A command line with a device UUID")
+    {
+        std::vector<std::string> args{
+            "vkmark", "--use-device", "000102030405060708090a0b0c0d0e0f"};
+        auto argv = argv_from_vector(args);
+
+        WHEN("parsing the args")
+        {
+            REQUIRE(options.parse_args(args.size(), argv.get()));
+
+            THEN("the UUID is also parsed")
+            {
+                REQUIRE(options.use_device == "000102030405060708090a0b0c0d0e0f");
+                REQUIRE(options.use_device_with_uuid);
+                REQUIRE(options.use_device_with_uuid->representation().data() ==
+                        std::string{"000102030405060708090a0b0c0d0e0f"});
+            }
+        }
+    }
+
     GIVEN("A complex command line")
     {
         std::vector<std::string> args{
@@ -0,0 +1,89 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "src/present_speedup.h"
+
+#include "catch.hpp"
+
+namespace
+{
+
+BenchmarkResult test_result(std::string const& duration,
+                            std::string const& present,
+                            unsigned int fps)
+{
+    BenchmarkResult result{};
+    result.scene = "cube";
+    result.description = "[cube] present=" + present;
+    result.options = {{"duration", duration}, {"present", present}};
+    result.fps = fps;
+    return result;
+}
+
+}
+
+SCENARIO("present speedup", "")
+{
+    GIVEN("Threaded and inline present results")
+    {
+        std::vector<BenchmarkResult> const results{
+            test_result("10.0", "inline", 400),
+            test_result("10.0", "thread", 500),
+            test_result("5.0", "thread", 300)};
+
+        WHEN("computing the speedup")
+        {
+            auto const entries = PresentSpeedup::compute(results);
+
+            THEN("there is an entry for each threaded result")
+            {
+                REQUIRE(entries.size() == 2);
+                REQUIRE(entries[0].fps == 500);
+            }
+
+            THEN("the speedup is relative to the inline result with equal options")
+            {
+                REQUIRE(entries[0].has_baseline);
+                REQUIRE(entries[0].inline_fps == 400);
+                REQUIRE(entries[0].speedup == 1.25);
+            }
+
+            THEN("results without an inline counterpart have no baseline")
+            {
+                REQUIRE_FALSE(entries[1].has_baseline);
+            }
+        }
+    }
+
+    GIVEN("Only inline results")
+    {
+        std::vector<BenchmarkResult> const results{test_result("10.0", "inline", 400)};
+
+        WHEN("computing the speedup")
+        {
+            auto const entries = PresentSpeedup::compute(results);
+
+            THEN("there are no entries")
+            {
+                REQUIRE(entries.empty());
+            }
+        }
+    }
+}
@@ -0,0 +1,177 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "src/present_thread.h"
+
+#include "null_window_system.h"
+
+#include "catch.hpp"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+
+class CountingWindowSystem : public NullWindowSystem
+{
+public:
+    CountingWindowSystem(uint32_t max_acquired)
+        : max_acquired{max_acquired}, next_index{0}, num_acquired{0},
+          max_num_acquired{0}, fail_present{false}
+    {
+    }
+
+    VulkanImage next_vulkan_image() override
+    {
+        VulkanImage image{};
+        image.index = next_index++;
+
+        auto const n = ++num_acquired;
+        if (n > max_num_acquired)
+            max_num_acquired = n;
+
+        return image;
+    }
+
+    void present_vulkan_image(VulkanImage const& image) override
+    {
+        if (fail_present)
+            throw std::runtime_error{"present failed"};
+
+        presented.push_back(image.index);
+        --num_acquired;
+    }
+
+    uint32_t max_acquired_images() override { return max_acquired; }
+
+    uint32_t const max_acquired;
+    std::atomic<uint32_t> next_index;
+    std::atomic<uint32_t> num_acquired;
+    std::atomic<uint32_t> max_num_acquired;
+    std::atomic<bool> fail_present;
+    // Only read after the present thread has stopped
+    std::vector<uint32_t> presented;
+};
+
+void run_frames(PresentThread& present_thread, int frames)
+{
+    for (int i = 0; i < frames; ++i)
+        present_thread.present_vulkan_image(present_thread.next_vulkan_image());
+}
+
+std::vector<uint32_t> indices(uint32_t count)
+{
+    std::vector<uint32_t> v;
+    for (uint32_t i = 0; i < count; ++i)
+        v.push_back(i);
+    return v;
+}
+
+}
+
+SCENARIO("present thread", "")
+{
+    GIVEN("A window system that allows two acquired images")
+    {
+        CountingWindowSystem ws{2};
+        PresentThread present_thread{ws};
+
+        WHEN("running frames on the present thread")
+        {
+            present_thread.start();
+            run_frames(present_thread, 100);
+            present_thread.stop();
+
+            THEN("all images are presented in order")
+            {
+                REQUIRE(ws.presented == indices(100));
+            }
+
+            THEN("the next image is acquired before the previous one is presented")
+            {
+                REQUIRE(ws.max_num_acquired == 2);
+            }
+
+            THEN("images acquired in advance are used after the thread stops")
+            {
+                run_frames(present_thread, 3);
+
+                REQUIRE(ws.presented == indices(103));
+                REQUIRE(ws.next_index == 103);
+                REQUIRE(ws.num_acquired == 0);
+            }
+        }
+
+        WHEN("restarting the present thread")
+        {
+            present_thread.start();
+            run_frames(present_thread, 10);
+            present_thread.stop();
+            present_thread.start();
+            run_frames(present_thread, 10);
+            present_thread.stop();
+
+            THEN("the acquired images never exceed the limit")
+            {
+                REQUIRE(ws.presented == indices(20));
+                REQUIRE(ws.max_num_acquired <= 2);
+            }
+        }
+    }
+
+    GIVEN("A window system that allows a single acquired image")
+    {
+        CountingWindowSystem ws{1};
+        PresentThread present_thread{ws};
+
+        WHEN("running frames on the present thread")
+        {
+            present_thread.start();
+            run_frames(present_thread, 100);
+            present_thread.stop();
+
+            THEN("each image is presented before the next one is acquired")
+            {
+                REQUIRE(ws.presented == indices(100));
+                REQUIRE(ws.max_num_acquired == 1);
+            }
+        }
+    }
+
+    GIVEN("A window system that fails to present")
+    {
+        CountingWindowSystem ws{2};
+        PresentThread present_thread{ws};
+        ws.fail_present = true;
+
+        WHEN("running frames on the present thread")
+        {
+            present_thread.start();
+
+            THEN("the exception is rethrown on the rendering thread")
+            {
+                REQUIRE_THROWS_WITH(run_frames(present_thread, 100), "present failed");
+                REQUIRE_NOTHROW(present_thread.stop());
+            }
+        }
+    }
+}
@@ -0,0 +1,305 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "src/results.h"
+
+#include "catch.hpp"
+
+#include <sstream>
+
+using namespace Catch::Matchers;
+
+namespace
+{
+
+RunInfo test_run_info()
+{
+    RunInfo run_info{};
+    run_info.vkmark_version = "1.0";
+    run_info.window_system = "headless";
+    run_info.present_mode = "fifo";
+    run_info.vendor_id = 0x1002;
+    run_info.device_id = 0x73bf;
+    run_info.device_name = "Test \"GPU\"";
+    run_info.driver_version = 1234;
+    run_info.device_uuid = "00112233445566778899aabbccddeeff";
+    return run_info;
+}
+
+BenchmarkResult test_result(std::string const& scene, unsigned int fps)
+{
+    BenchmarkResult result{};
+    result.scene = scene;
+    result.options = {{"color", "1,0,0"}, {"duration", "1.0"}};
+    result.fps = fps;
+    result.duration_s = 1.0;
+    result.frames = fps;
+    result.frame_time_mean = 1000.0 / fps;
+    return result;
+}
+
+}
+
+SCENARIO("results output", "")
+{
+    auto const run_info = test_run_info();
+    std::vector<BenchmarkResult> const results{
+        test_result("clear", 1000), test_result("vertex", 50)};
+    std::stringstream ss;
+
+    GIVEN("Some benchmark results")
+    {
+        WHEN("writing them as json")
+        {
+            Results::write_json(ss, run_info, results, 525);
+            auto const json = ss.str();
+
+            THEN("the run information is written")
+            {
+                REQUIRE_THAT(json, Contains("\"window_system\": \"headless\""));
+                REQUIRE_THAT(json, Contains("\"present_mode\": \"fifo\""));
+                REQUIRE_THAT(json, Contains("\"vendor_id\": \"0x1002\""));
+                REQUIRE_THAT(json, Contains("\"device_name\": \"Test \\\"GPU\\\"\""));
+                REQUIRE_THAT(json, Contains("\"driver_version\": 1234"));
+                REQUIRE_THAT(json, Contains("\"score\": 525"));
+            }
+
+            THEN("the benchmark results are written")
+            {
+                REQUIRE_THAT(json, Contains("\"scene\": \"clear\""));
+                REQUIRE_THAT(json, Contains("\"scene\": \"vertex\""));
+                REQUIRE_THAT(json, Contains("\"color\": \"1,0,0\""));
+                REQUIRE_THAT(json, Contains("\"fps\": 1000"));
+                REQUIRE_THAT(json, Contains("\"mean\": 20"));
+            }
+
+            THEN("gpu times and pipeline statistics are not written when not available")
+            {
+                REQUIRE_THAT(json, !Contains("gpu_time_ms"));
+                REQUIRE_THAT(json, !Contains("pipeline_stats"));
+            }
+        }
+
+        WHEN("writing them as json and reading them back")
+        {
+            auto with_gpu = results;
+            with_gpu[1].gpu_time_samples = 10;
+            with_gpu[1].gpu_time_mean = 1.5;
+
+            Results::write_json(ss, run_info, with_gpu, 525);
+            auto const read = Results::read_json(ss);
+
+            THEN("the same results are read")
+            {
+                REQUIRE(read.size() == 2);
+                REQUIRE(read[0].scene == "clear");
+                REQUIRE(read[0].options == results[0].options);
+                REQUIRE(read[0].fps == 1000);
+                REQUIRE(read[0].frames == 1000);
+                REQUIRE(read[0].frame_time_mean == 1.0);
+                REQUIRE(read[0].gpu_time_samples == 0);
+                REQUIRE(read[1].scene == "vertex");
+                REQUIRE(read[1].fps == 50);
+                REQUIRE(read[1].frame_time_mean == 20.0);
+                REQUIRE(read[1].gpu_time_samples == 10);
+                REQUIRE(read[1].gpu_time_mean == 1.5);
+            }
+        }
+
+        WHEN("writing them as json with setup times")
+        {
+            auto with_setup = results;
+            with_setup[0].setup_time_ms = 12.5;
+            with_setup[0].teardown_time_ms = 2.0;
+            with_setup[0].setup_phases = {{"model", 1500}, {"pipeline", 8000}};
+            auto startup_run_info = run_info;
+            startup_run_info.startup_phases = {{"instance", 4000}, {"init vulkan", 6000}};
+
+            Results::write_json(ss, startup_run_info, with_setup, 525);
+            auto const json = ss.str();
+            auto const read = Results::read_json(ss);
+
+            THEN("the startup and setup times are written")
+            {
+                REQUIRE_THAT(json, Contains("\"startup_time_ms\": 10"));
+                REQUIRE_THAT(json, Contains(
+                    "\"startup_phases_ms\": {\"instance\": 4, \"init vulkan\": 6}"));
+                REQUIRE_THAT(json, Contains("\"setup_time_ms\": 12.5"));
+                REQUIRE_THAT(json, Contains(
+                    "\"setup_phases_ms\": {\"model\": 1.5, \"pipeline\": 8}"));
+                REQUIRE_THAT(json, Contains("\"teardown_time_ms\": 2"));
+            }
+
+            THEN("the setup times are read back")
+            {
+                REQUIRE(read[0].setup_time_ms == 12.5);
+                REQUIRE(read[0].teardown_time_ms == 2.0);
+                REQUIRE(read[0].setup_phases.size() == 2);
+                REQUIRE(read[0].setup_phases[0].name == "model");
+                REQUIRE(read[0].setup_phases[0].duration == 1500);
+                REQUIRE(read[0].setup_phases[1].name == "pipeline");
+                REQUIRE(read[0].setup_phases[1].duration == 8000);
+            }
+        }
+
+        WHEN("writing them as json with frames in flight")
+        {
+            auto with_frames_in_flight = results;
+            with_frames_in_flight[1].frames_in_flight = 3;
+            with_frames_in_flight[1].frame_wait_ms = 0.25;
+            with_frames_in_flight[1].cpu_gpu_overlap = 0.75;
+
+            Results::write_json(ss, run_info, with_frames_in_flight, 525);
+            auto const json = ss.str();
+            auto const read = Results::read_json(ss);
+
+            THEN("the frames in flight and the overlap are written and read back")
+            {
+                REQUIRE_THAT(json, Contains("\"frames_in_flight\": 3"));
+                REQUIRE_THAT(json, Contains("\"cpu_gpu_overlap\": 0.75"));
+                REQUIRE(read[0].frames_in_flight == 0);
+                REQUIRE(read[1].frames_in_flight == 3);
+                REQUIRE(read[1].frame_wait_ms == 0.25);
+                REQUIRE(read[1].cpu_gpu_overlap == 0.75);
+            }
+        }
+
+        WHEN("writing them as json with scene metrics")
+        {
+            auto with_metrics = results;
+            with_metrics[1].metrics = {{"record_time_ms", 1.5}};
+
+            Results::write_json(ss, run_info, with_metrics, 525);
+            auto const json = ss.str();
+            auto const read = Results::read_json(ss);
+
+            THEN("the metrics are written and read back")
+            {
+                REQUIRE_THAT(json, Contains("\"metrics\": {\"record_time_ms\": 1.5}"));
+                REQUIRE(read[0].metrics.empty());
+                REQUIRE(read[1].metrics.size() == 1);
+                REQUIRE(read[1].metrics[0].first == "record_time_ms");
+                REQUIRE(read[1].metrics[0].second == 1.5);
+            }
+        }
+
+        WHEN("writing them as json with image validation")
+        {
+            auto with_validation = results;
+            with_validation[1].has_validation = true;
+            with_validation[1].valid = false;
+            with_validation[1].image_hash = "0123456789abcdef";
+            with_validation[1].mismatched_pixels = 42;
+
+            Results::write_json(ss, run_info, with_validation, 525);
+            auto const json = ss.str();
+            auto const read = Results::read_json(ss);
+
+            THEN("the validation is written and read back")
+            {
+                REQUIRE_THAT(json, Contains("\"validation\": {\"valid\": false"));
+                REQUIRE_FALSE(read[0].has_validation);
+                REQUIRE(read[1].has_validation);
+                REQUIRE_FALSE(read[1].valid);
+                REQUIRE(read[1].image_hash == "0123456789abcdef");
+                REQUIRE(read[1].mismatched_pixels == 42);
+            }
+        }
+
+        WHEN("writing them as json with pipeline statistics")
+        {
+            auto with_stats = results;
+            with_stats[1].pipeline_stats_samples = 50;
+            with_stats[1].input_assembly_primitives = 200;
+            with_stats[1].fragment_shader_invocations = 1000;
+
+            Results::write_json(ss, run_info, with_stats, 525);
+            auto const json = ss.str();
+
+            THEN("the statistics and the derived throughput are written")
+            {
+                REQUIRE_THAT(json, Contains("\"pipeline_stats\": {\"samples\": 50"));
+                REQUIRE_THAT(json, Contains("\"input_assembly_primitives\": 200"));
+                REQUIRE_THAT(json, Contains("\"primitives_per_s\": 10000"));
+                REQUIRE_THAT(json, Contains("\"fragments_per_s\": 50000"));
+            }
+
+            THEN("the statistics are read back")
+            {
+                auto const read = Results::read_json(ss);
+
+                REQUIRE(read[0].pipeline_stats_samples == 0);
+                REQUIRE(read[1].pipeline_stats_samples == 50);
+                REQUIRE(read[1].fragment_shader_invocations == 1000);
+            }
+        }
+
+        WHEN("writing them as csv")
+        {
+            Results::write_csv(ss, run_info, results);
+
+            std::vector<std::string> lines;
+            std::string line;
+            while (std::getline(ss, line))
+                lines.push_back(line);
+
+            THEN("a header and a line per benchmark are written")
+            {
+                REQUIRE(lines.size() == 3);
+                REQUIRE_THAT(lines[0], StartsWith("vkmark_version,window_system,"));
+                REQUIRE_THAT(lines[1], Contains(",clear,\"color=1,0,0:duration=1.0\",1000,"));
+                REQUIRE_THAT(lines[2], Contains(",vertex,\"color=1,0,0:duration=1.0\",50,"));
+            }
+
+            THEN("fields with special characters are quoted")
+            {
+                REQUIRE_THAT(lines[1], Contains(",\"Test \"\"GPU\"\"\","));
+            }
+        }
+    }
+}
+
+SCENARIO("results input", "")
+{
+    GIVEN("Invalid json")
+    {
+        std::stringstream ss{"{\"benchmarks\": [{\"scene\": \"clear\", }]}"};
+
+        WHEN("reading it")
+        {
+            THEN("an exception is thrown")
+            {
+                REQUIRE_THROWS(Results::read_json(ss));
+            }
+        }
+    }
+
+    GIVEN("Json without benchmarks")
+    {
+        std::stringstream ss{"{\"score\": 10}"};
+
+        WHEN("reading it")
+        {
+            THEN("an exception is thrown")
+            {
+                REQUIRE_THROWS(Results::read_json(ss));
+            }
+        }
+    }
+}
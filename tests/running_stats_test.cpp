@@ -0,0 +1,77 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "src/running_stats.h"
+
+#include "catch.hpp"
+
+SCENARIO("running stats", "")
+{
+    RunningStats stats;
+
+    GIVEN("No samples")
+    {
+        THEN("all statistics are zero")
+        {
+            REQUIRE(stats.count() == 0);
+            REQUIRE(stats.mean() == 0.0);
+            REQUIRE(stats.stddev() == 0.0);
+            REQUIRE(stats.cv() == 0.0);
+            REQUIRE(stats.confidence_interval95() == 0.0);
+        }
+    }
+
+    GIVEN("Some samples")
+    {
+        for (auto const sample : {98.0, 100.0, 102.0, 100.0})
+            stats.add(sample);
+
+        THEN("the statistics are calculated")
+        {
+            REQUIRE(stats.count() == 4);
+            REQUIRE(stats.mean() == Approx(100.0));
+            REQUIRE(stats.stddev() == Approx(1.63299));
+            REQUIRE(stats.cv() == Approx(0.0163299));
+            REQUIRE(stats.confidence_interval95() == Approx(3.182 * 1.63299 / 2.0));
+        }
+
+        WHEN("resetting the stats")
+        {
+            stats.reset();
+
+            THEN("the samples are discarded")
+            {
+                REQUIRE(stats.count() == 0);
+                REQUIRE(stats.mean() == 0.0);
+            }
+        }
+    }
+
+    GIVEN("Identical samples")
+    {
+        for (int i = 0; i < 10; ++i)
+            stats.add(60.0);
+
+        THEN("there is no variation")
+        {
+            REQUIRE(stats.stddev() == Approx(0.0));
+            REQUIRE(stats.cv() == Approx(0.0));
+        }
+    }
+}
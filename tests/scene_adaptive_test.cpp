@@ -0,0 +1,63 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "src/scene.h"
+#include "src/vulkan_image.h"
+
+#include "test_scene.h"
+
+#include "catch.hpp"
+
+SCENARIO("scene adaptive duration", "")
+{
+    VulkanState* null_vulkan_state = nullptr;
+    TestScene scene{TestScene::name(1)};
+
+    GIVEN("A scene without adaptive duration")
+    {
+        scene.setup(*null_vulkan_state, {});
+
+        THEN("the scene is not adaptive")
+        {
+            REQUIRE_FALSE(scene.is_adaptive());
+        }
+    }
+
+    GIVEN("A scene with adaptive duration and a loose variation threshold")
+    {
+        scene.set_option("adaptive-cv", "1000.0");
+        scene.set_option("adaptive-window", "0.001");
+        scene.set_option("adaptive-min-duration", "0.0");
+        scene.setup(*null_vulkan_state, {});
+        scene.start();
+
+        WHEN("rendering frames until the scene stops")
+        {
+            while (scene.is_running())
+                scene.update();
+
+            THEN("the scene stops after a few windows because it has converged")
+            {
+                REQUIRE(scene.is_adaptive());
+                REQUIRE(scene.has_converged());
+                REQUIRE(scene.window_fps_stats().count() == 3);
+            }
+        }
+    }
+}
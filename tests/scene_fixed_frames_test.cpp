@@ -0,0 +1,144 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "src/scene.h"
+#include "src/vulkan_image.h"
+
+#include "test_scene.h"
+
+#include "catch.hpp"
+
+namespace
+{
+
+class AnimatedTestScene : public TestScene
+{
+public:
+    AnimatedTestScene() : TestScene{TestScene::name(1)} {}
+
+    void update() override
+    {
+        animation_times.push_back(animation_time());
+        TestScene::update();
+    }
+
+    std::vector<double> animation_times;
+};
+
+}
+
+SCENARIO("scene fixed frames", "")
+{
+    VulkanState* null_vulkan_state = nullptr;
+    AnimatedTestScene scene;
+
+    GIVEN("A scene with a fixed number of frames")
+    {
+        scene.set_option("frames", "5");
+        scene.set_option("duration", "0.0");
+        scene.setup(*null_vulkan_state, {});
+        scene.start();
+
+        WHEN("rendering fewer frames")
+        {
+            for (int i = 0; i < 4; ++i)
+                scene.update();
+
+            THEN("the scene is still running, regardless of the duration")
+            {
+                REQUIRE(scene.is_fixed_frames());
+                REQUIRE(scene.is_running());
+            }
+        }
+
+        WHEN("rendering all frames")
+        {
+            for (int i = 0; i < 5; ++i)
+                scene.update();
+
+            THEN("the scene stops")
+            {
+                REQUIRE_FALSE(scene.is_running());
+                REQUIRE(scene.num_frames() == 5);
+            }
+        }
+    }
+
+    GIVEN("A scene with a fixed number of frames and a warm-up phase")
+    {
+        scene.set_option("frames", "5");
+        scene.set_option("warmup-frames", "3");
+        scene.setup(*null_vulkan_state, {});
+        scene.start();
+
+        WHEN("rendering the warm-up and the fixed frames")
+        {
+            for (int i = 0; i < 8; ++i)
+                scene.update();
+
+            THEN("only the frames after the warm-up phase are counted")
+            {
+                REQUIRE_FALSE(scene.is_running());
+                REQUIRE(scene.num_frames() == 5);
+            }
+        }
+    }
+
+    GIVEN("A scene with a fixed timestep")
+    {
+        scene.set_option("timestep", "0.5");
+        scene.setup(*null_vulkan_state, {});
+
+        WHEN("rendering frames in two runs")
+        {
+            scene.start();
+            for (int i = 0; i < 3; ++i)
+                scene.update();
+            auto const first_run = scene.animation_times;
+
+            scene.animation_times.clear();
+            scene.start();
+            for (int i = 0; i < 3; ++i)
+                scene.update();
+
+            THEN("the animation advances by the timestep with every frame")
+            {
+                REQUIRE(first_run == std::vector<double>{500000.0, 1000000.0, 1500000.0});
+            }
+
+            THEN("both runs render the same animation")
+            {
+                REQUIRE(scene.animation_times == first_run);
+            }
+        }
+    }
+
+    GIVEN("A scene with a fixed number of frames and adaptive mode")
+    {
+        scene.set_option("frames", "5");
+        scene.set_option("adaptive-cv", "0.05");
+        scene.setup(*null_vulkan_state, {});
+
+        THEN("the fixed number of frames takes precedence")
+        {
+            REQUIRE_FALSE(scene.is_adaptive());
+        }
+    }
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "src/scene.h"
+#include "src/vulkan_image.h"
+
+#include "test_scene.h"
+
+#include "catch.hpp"
+
+SCENARIO("scene warm-up", "")
+{
+    VulkanState* null_vulkan_state = nullptr;
+    TestScene scene{TestScene::name(1)};
+
+    GIVEN("A scene without a warm-up phase")
+    {
+        scene.setup(*null_vulkan_state, {});
+        scene.start();
+
+        WHEN("rendering some frames")
+        {
+            for (int i = 0; i < 3; ++i)
+                scene.update();
+
+            THEN("all frames are measured")
+            {
+                REQUIRE_FALSE(scene.is_warming_up());
+                REQUIRE(scene.frame_time_stats().count() == 3);
+            }
+        }
+    }
+
+    GIVEN("A scene with a warm-up phase defined in frames")
+    {
+        scene.set_option("warmup-frames", "5");
+        scene.setup(*null_vulkan_state, {});
+        scene.start();
+
+        WHEN("rendering fewer frames than the warm-up frames")
+        {
+            for (int i = 0; i < 4; ++i)
+                scene.update();
+
+            THEN("the scene is still warming up")
+            {
+                REQUIRE(scene.is_warming_up());
+                REQUIRE(scene.is_running());
+            }
+        }
+
+        WHEN("rendering more frames than the warm-up frames")
+        {
+            for (int i = 0; i < 7; ++i)
+                scene.update();
+
+            THEN("only the frames after the warm-up phase are measured")
+            {
+                REQUIRE_FALSE(scene.is_warming_up());
+                REQUIRE(scene.frame_time_stats().count() == 2);
+            }
+        }
+    }
+
+    GIVEN("A scene with a warm-up phase defined in time")
+    {
+        scene.set_option("warmup", "60.0");
+        scene.setup(*null_vulkan_state, {});
+        scene.start();
+
+        WHEN("rendering some frames")
+        {
+            for (int i = 0; i < 3; ++i)
+                scene.update();
+
+            THEN("the scene is still warming up")
+            {
+                REQUIRE(scene.is_warming_up());
+            }
+        }
+    }
+}
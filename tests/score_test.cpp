@@ -0,0 +1,116 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "src/score.h"
+
+#include "catch.hpp"
+
+namespace
+{
+
+BenchmarkResult test_result(std::string const& scene, unsigned int fps)
+{
+    BenchmarkResult result{};
+    result.scene = scene;
+    result.options = {{"duration", "1.0"}};
+    result.fps = fps;
+    result.frames = fps;
+    result.frame_time_mean = fps > 0 ? 1000.0 / fps : 0.0;
+    return result;
+}
+
+}
+
+SCENARIO("score calculation", "")
+{
+    std::vector<BenchmarkResult> const results{
+        test_result("clear", 1000), test_result("cube", 10)};
+    std::vector<BenchmarkResult> const no_results;
+
+    GIVEN("The fps score method")
+    {
+        THEN("the score is the arithmetic mean of the fps")
+        {
+            REQUIRE(Score::calculate(ScoreMethod::fps, results, {}) == 505);
+            REQUIRE(Score::calculate(ScoreMethod::fps, no_results, {}) == 0);
+        }
+    }
+
+    GIVEN("The geomean score method")
+    {
+        THEN("the score is the geometric mean of the fps")
+        {
+            REQUIRE(Score::calculate(ScoreMethod::geomean, results, {}) ==
+                    Approx(100.0));
+            REQUIRE(Score::calculate(ScoreMethod::geomean, no_results, {}) == 0);
+        }
+
+        THEN("benchmarks without frames are ignored")
+        {
+            auto with_empty = results;
+            with_empty.push_back(test_result("vertex", 0));
+
+            REQUIRE(Score::calculate(ScoreMethod::geomean, with_empty, {}) ==
+                    Approx(100.0));
+        }
+    }
+
+    GIVEN("The frametime score method")
+    {
+        THEN("the score is the arithmetic mean of the frame times")
+        {
+            REQUIRE(Score::calculate(ScoreMethod::frametime, results, {}) ==
+                    Approx(50.5));
+        }
+    }
+
+    GIVEN("The reference score method")
+    {
+        std::vector<BenchmarkResult> const reference{
+            test_result("clear", 500), test_result("cube", 20),
+            test_result("vertex", 100)};
+
+        THEN("the score is the geometric mean of the relative fps")
+        {
+            // Ratios are 2.0 and 0.5
+            REQUIRE(Score::calculate(ScoreMethod::reference, results, reference) ==
+                    Approx(100.0));
+        }
+
+        THEN("benchmarks not in the reference are ignored")
+        {
+            auto with_missing = results;
+            with_missing.push_back(test_result("shading", 100));
+            with_missing[1].options = {{"duration", "2.0"}};
+
+            REQUIRE(Score::calculate(ScoreMethod::reference, with_missing, reference) ==
+                    Approx(200.0));
+        }
+
+        THEN("options that the reference doesn't have are ignored when matching")
+        {
+            auto with_new_options = results;
+            for (auto& r : with_new_options)
+                r.options.push_back({"frames-in-flight", "2"});
+
+            REQUIRE(Score::calculate(ScoreMethod::reference, with_new_options, reference) ==
+                    Approx(100.0));
+        }
+    }
+}
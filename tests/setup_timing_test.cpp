@@ -0,0 +1,108 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "src/setup_timing.h"
+
+#include "catch.hpp"
+
+#include <stdexcept>
+
+SCENARIO("setup timing", "")
+{
+    GIVEN("A setup timing")
+    {
+        SetupTiming timing;
+
+        WHEN("recording phases")
+        {
+            timing.record("model", 100);
+            timing.record("pipeline", 300);
+            timing.record("model", 50);
+
+            THEN("phases keep their first recorded order and durations add up")
+            {
+                auto const& phases = timing.phases();
+                REQUIRE(phases.size() == 2);
+                REQUIRE(phases[0].name == "model");
+                REQUIRE(phases[0].duration == 150);
+                REQUIRE(phases[1].name == "pipeline");
+                REQUIRE(phases[1].duration == 300);
+                REQUIRE(timing.total() == 450);
+            }
+        }
+
+        WHEN("recording the phases of another timing")
+        {
+            SetupTiming other;
+            other.record("instance", 10);
+            other.record("model", 20);
+
+            timing.record("model", 5);
+            timing.record(other);
+
+            THEN("the phases are merged")
+            {
+                auto const& phases = timing.phases();
+                REQUIRE(phases.size() == 2);
+                REQUIRE(phases[0].name == "model");
+                REQUIRE(phases[0].duration == 25);
+                REQUIRE(phases[1].name == "instance");
+                REQUIRE(phases[1].duration == 10);
+            }
+        }
+
+        WHEN("timing a function")
+        {
+            auto const value = timing.timed("texture", [] { return 42; });
+
+            THEN("its value is returned and the phase is recorded")
+            {
+                REQUIRE(value == 42);
+                REQUIRE(timing.phases().size() == 1);
+                REQUIRE(timing.phases()[0].name == "texture");
+            }
+        }
+
+        WHEN("timing a function that throws")
+        {
+            REQUIRE_THROWS_AS(
+                timing.timed("pipeline", [] { throw std::runtime_error{"error"}; }),
+                std::runtime_error);
+
+            THEN("the phase is still recorded")
+            {
+                REQUIRE(timing.phases().size() == 1);
+                REQUIRE(timing.phases()[0].name == "pipeline");
+            }
+        }
+
+        WHEN("resetting")
+        {
+            timing.record("model", 100);
+            timing.reset();
+
+            THEN("all phases are removed")
+            {
+                REQUIRE(timing.phases().empty());
+                REQUIRE(timing.total() == 0);
+            }
+        }
+    }
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "src/spsc_queue.h"
+
+#include "catch.hpp"
+
+#include <thread>
+
+SCENARIO("spsc queue", "")
+{
+    GIVEN("An empty queue")
+    {
+        SPSCQueue<int> queue{3};
+
+        THEN("it is empty")
+        {
+            int value;
+
+            REQUIRE(queue.capacity() == 3);
+            REQUIRE(queue.empty());
+            REQUIRE_FALSE(queue.pop(value));
+        }
+
+        WHEN("pushing values")
+        {
+            REQUIRE(queue.push(1));
+            REQUIRE(queue.push(2));
+
+            THEN("they are popped in order")
+            {
+                int value;
+
+                REQUIRE(queue.pop(value));
+                REQUIRE(value == 1);
+                REQUIRE(queue.pop(value));
+                REQUIRE(value == 2);
+                REQUIRE(queue.empty());
+            }
+        }
+
+        WHEN("pushing more values than its capacity")
+        {
+            REQUIRE(queue.push(1));
+            REQUIRE(queue.push(2));
+            REQUIRE(queue.push(3));
+
+            THEN("the extra values are rejected until values are popped")
+            {
+                int value;
+
+                REQUIRE_FALSE(queue.push(4));
+                REQUIRE(queue.pop(value));
+                REQUIRE(queue.push(4));
+            }
+        }
+    }
+
+    GIVEN("A producer and a consumer thread")
+    {
+        SPSCQueue<int> queue{4};
+        int const num_values = 100000;
+
+        WHEN("passing values through the queue")
+        {
+            std::thread producer{
+                [&]
+                {
+                    for (int i = 0; i < num_values; ++i)
+                    {
+                        while (!queue.push(i))
+                            std::this_thread::yield();
+                    }
+                }};
+
+            bool in_order = true;
+            for (int i = 0; i < num_values; ++i)
+            {
+                int value;
+                while (!queue.pop(value))
+                    std::this_thread::yield();
+                in_order = in_order && value == i;
+            }
+
+            producer.join();
+
+            THEN("all values are received in order")
+            {
+                REQUIRE(in_order);
+                REQUIRE(queue.empty());
+            }
+        }
+    }
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "src/tenant_fairness.h"
+
+#include "catch.hpp"
+
+SCENARIO("tenant fairness", "")
+{
+    GIVEN("Tenants with equal throughput")
+    {
+        auto const stats = TenantFairness::compute({100, 100, 100, 100});
+
+        THEN("the throughput is shared fairly")
+        {
+            REQUIRE(stats.min_fps == 100);
+            REQUIRE(stats.max_fps == 100);
+            REQUIRE(stats.mean_fps == 100.0);
+            REQUIRE(stats.fairness == 1.0);
+            REQUIRE(stats.jain_index == 1.0);
+        }
+    }
+
+    GIVEN("Tenants with unequal throughput")
+    {
+        auto const stats = TenantFairness::compute({100, 300});
+
+        THEN("the fairness is below 1")
+        {
+            REQUIRE(stats.min_fps == 100);
+            REQUIRE(stats.max_fps == 300);
+            REQUIRE(stats.mean_fps == 200.0);
+            REQUIRE(stats.fairness == Approx(1.0 / 3.0));
+            REQUIRE(stats.jain_index == Approx(0.8));
+        }
+    }
+
+    GIVEN("Tenants that rendered no frames")
+    {
+        auto const stats = TenantFairness::compute({0, 0});
+
+        THEN("the fairness is zero")
+        {
+            REQUIRE(stats.fairness == 0.0);
+            REQUIRE(stats.jain_index == 0.0);
+        }
+    }
+
+    GIVEN("No tenants")
+    {
+        auto const stats = TenantFairness::compute({});
+
+        THEN("all statistics are zero")
+        {
+            REQUIRE(stats.max_fps == 0);
+            REQUIRE(stats.mean_fps == 0.0);
+            REQUIRE(stats.fairness == 0.0);
+        }
+    }
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "src/thread_scaling.h"
+
+#include "catch.hpp"
+
+namespace
+{
+
+BenchmarkResult test_result(std::string const& draws,
+                            std::string const& threads,
+                            double record_time_ms)
+{
+    BenchmarkResult result{};
+    result.scene = "multithread";
+    result.description = "[multithread] threads=" + threads;
+    result.options = {{"draws", draws}, {"threads", threads}};
+    result.metrics = {{"record_time_ms", record_time_ms}};
+    return result;
+}
+
+}
+
+SCENARIO("thread scaling", "")
+{
+    GIVEN("Results for increasing thread counts")
+    {
+        BenchmarkResult clear{};
+        clear.scene = "clear";
+
+        std::vector<BenchmarkResult> const results{
+            clear,
+            test_result("100", "1", 8.0),
+            test_result("100", "2", 5.0),
+            test_result("100", "4", 4.0),
+            test_result("200", "4", 4.0)};
+
+        WHEN("computing the scaling")
+        {
+            auto const entries = ThreadScaling::compute(results);
+
+            THEN("results without a record time are skipped")
+            {
+                REQUIRE(entries.size() == 4);
+                REQUIRE(ThreadScaling::has_scaling(entries));
+            }
+
+            THEN("the speedup and efficiency are relative to the single threaded result")
+            {
+                REQUIRE(entries[0].has_baseline);
+                REQUIRE(entries[0].speedup == 1.0);
+                REQUIRE(entries[1].threads == 2);
+                REQUIRE(entries[1].speedup == 1.6);
+                REQUIRE(entries[1].efficiency == 0.8);
+                REQUIRE(entries[2].speedup == 2.0);
+                REQUIRE(entries[2].efficiency == 0.5);
+            }
+
+            THEN("results with different options have no baseline")
+            {
+                REQUIRE_FALSE(entries[3].has_baseline);
+            }
+        }
+    }
+
+    GIVEN("Only single threaded results")
+    {
+        std::vector<BenchmarkResult> const results{test_result("100", "1", 8.0)};
+
+        WHEN("computing the scaling")
+        {
+            auto const entries = ThreadScaling::compute(results);
+
+            THEN("there is no scaling to report")
+            {
+                REQUIRE_FALSE(ThreadScaling::has_scaling(entries));
+            }
+        }
+    }
+}
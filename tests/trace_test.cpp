@@ -0,0 +1,117 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "src/trace.h"
+#include "src/util.h"
+
+#include "catch.hpp"
+
+#include <sstream>
+#include <thread>
+
+using namespace Catch::Matchers;
+
+SCENARIO("trace", "")
+{
+    auto const trace_disable = Util::on_scope_exit([] { Trace::disable(); });
+
+    GIVEN("A disabled trace")
+    {
+        WHEN("recording events")
+        {
+            Trace::record("event", 1000, 2000);
+            { Trace::Scope const scope{"scope"}; }
+
+            THEN("no events are stored")
+            {
+                REQUIRE_FALSE(Trace::is_enabled());
+                REQUIRE(Trace::events().empty());
+            }
+        }
+    }
+
+    GIVEN("An enabled trace")
+    {
+        Trace::enable(4);
+
+        WHEN("recording events")
+        {
+            Trace::record("first", 1000, 3500);
+            auto const value = Trace::traced("traced", [] { return 5; });
+
+            THEN("the events are stored in order")
+            {
+                auto const events = Trace::events();
+
+                REQUIRE(value == 5);
+                REQUIRE(events.size() == 2);
+                REQUIRE(std::string{events[0].name} == "first");
+                REQUIRE(events[0].start_ns == 1000);
+                REQUIRE(events[0].duration_ns == 2500);
+                REQUIRE(std::string{events[1].name} == "traced");
+            }
+        }
+
+        WHEN("recording more events than the capacity")
+        {
+            for (uint64_t i = 0; i < 6; ++i)
+                Trace::record("event", i * 1000, i * 1000 + 10);
+
+            THEN("only the most recent events are kept")
+            {
+                auto const events = Trace::events();
+
+                REQUIRE(events.size() == 4);
+                REQUIRE(events.front().start_ns == 2000);
+                REQUIRE(events.back().start_ns == 5000);
+            }
+        }
+
+        WHEN("recording events from different threads")
+        {
+            Trace::record("main", 1000, 2000);
+            std::thread{[] { Trace::record("other", 3000, 4000); }}.join();
+
+            THEN("the events have different thread ids")
+            {
+                auto const events = Trace::events();
+
+                REQUIRE(events.size() == 2);
+                REQUIRE(events[0].thread_id != events[1].thread_id);
+            }
+        }
+
+        WHEN("writing the events as a chrome json trace")
+        {
+            Trace::record("acquire", 1001500, 1003750);
+
+            std::stringstream ss;
+            Trace::write_chrome_json(ss);
+
+            THEN("complete events with times in us are written")
+            {
+                REQUIRE_THAT(ss.str(), StartsWith("{\"displayTimeUnit\": \"ms\", \"traceEvents\": ["));
+                REQUIRE_THAT(ss.str(), Contains("\"name\": \"acquire\""));
+                REQUIRE_THAT(ss.str(), Contains("\"ph\": \"X\""));
+                REQUIRE_THAT(ss.str(), Contains("\"ts\": 1001.500"));
+                REQUIRE_THAT(ss.str(), Contains("\"dur\": 2.250"));
+            }
+        }
+    }
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright © 2026 vkmark developers
+ *
+ * This file is part of vkmark.
+ *
+ * vkmark is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * vkmark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with vkmark. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "src/worker_pool.h"
+
+#include "catch.hpp"
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+
+SCENARIO("worker pool", "")
+{
+    GIVEN("A worker pool with four workers")
+    {
+        WorkerPool pool{4};
+
+        WHEN("running a task")
+        {
+            std::vector<int> runs(pool.num_workers(), 0);
+            std::vector<std::thread::id> thread_ids(pool.num_workers());
+
+            pool.run(
+                [&] (size_t worker)
+                {
+                    ++runs[worker];
+                    thread_ids[worker] = std::this_thread::get_id();
+                });
+
+            THEN("the task runs once on each worker")
+            {
+                REQUIRE(pool.num_workers() == 4);
+                REQUIRE(runs == std::vector<int>{1, 1, 1, 1});
+            }
+
+            THEN("worker 0 is the calling thread")
+            {
+                REQUIRE(thread_ids[0] == std::this_thread::get_id());
+                REQUIRE(thread_ids[1] != std::this_thread::get_id());
+            }
+        }
+
+        WHEN("running several tasks")
+        {
+            std::atomic<int> total{0};
+
+            for (int i = 0; i < 100; ++i)
+                pool.run([&] (size_t) { ++total; });
+
+            THEN("all runs complete before run returns")
+            {
+                REQUIRE(total == 400);
+            }
+        }
+
+        WHEN("a task throws")
+        {
+            THEN("the exception is rethrown by run")
+            {
+                REQUIRE_THROWS_AS(
+                    pool.run(
+                        [] (size_t worker)
+                        {
+                            if (worker == 2)
+                                throw std::runtime_error{"error"};
+                        }),
+                    std::runtime_error);
+            }
+        }
+    }
+
+    GIVEN("A worker pool with a single worker")
+    {
+        WorkerPool pool{1};
+
+        WHEN("running a task")
+        {
+            std::thread::id thread_id;
+            pool.run([&] (size_t) { thread_id = std::this_thread::get_id(); });
+
+            THEN("the task runs on the calling thread")
+            {
+                REQUIRE(thread_id == std::this_thread::get_id());
+            }
+        }
+    }
+}